@@ -0,0 +1,1123 @@
+/* This file is automatically generated.  Do not edit. */
+
+#ifndef _MLTON_BASIS_FFI_H_
+#define _MLTON_BASIS_FFI_H_
+PRIVATE extern C_Int_t CommandLine_argc;
+PRIVATE extern C_StringArray_t CommandLine_argv;
+PRIVATE extern C_String_t CommandLine_commandName;
+PRIVATE C_String_t Cygwin_toFullWindowsPath(NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Date_gmTime(Ref(C_Time_t));
+PRIVATE C_Double_t Date_localOffset(void);
+PRIVATE C_Errno_t(C_Int_t) Date_localTime(Ref(C_Time_t));
+PRIVATE C_Errno_t(C_Time_t) Date_mkTime(void);
+PRIVATE C_Size_t Date_strfTime(Array(Char8_t),C_Size_t,NullString8_t);
+PRIVATE C_Int_t Date_Tm_getHour(void);
+PRIVATE C_Int_t Date_Tm_getIsDst(void);
+PRIVATE C_Int_t Date_Tm_getMDay(void);
+PRIVATE C_Int_t Date_Tm_getMin(void);
+PRIVATE C_Int_t Date_Tm_getMon(void);
+PRIVATE C_Int_t Date_Tm_getSec(void);
+PRIVATE C_Int_t Date_Tm_getWDay(void);
+PRIVATE C_Int_t Date_Tm_getYDay(void);
+PRIVATE C_Int_t Date_Tm_getYear(void);
+PRIVATE void Date_Tm_setHour(C_Int_t);
+PRIVATE void Date_Tm_setIsDst(C_Int_t);
+PRIVATE void Date_Tm_setMDay(C_Int_t);
+PRIVATE void Date_Tm_setMin(C_Int_t);
+PRIVATE void Date_Tm_setMon(C_Int_t);
+PRIVATE void Date_Tm_setSec(C_Int_t);
+PRIVATE void Date_Tm_setWDay(C_Int_t);
+PRIVATE void Date_Tm_setYDay(C_Int_t);
+PRIVATE void Date_Tm_setYear(C_Int_t);
+PRIVATE C_Int_t IEEEReal_getRoundingMode(void);
+PRIVATE extern const C_Int_t IEEEReal_RoundingMode_FE_DOWNWARD;
+PRIVATE extern const C_Int_t IEEEReal_RoundingMode_FE_NOSUPPORT;
+PRIVATE extern const C_Int_t IEEEReal_RoundingMode_FE_TONEAREST;
+PRIVATE extern const C_Int_t IEEEReal_RoundingMode_FE_TOWARDZERO;
+PRIVATE extern const C_Int_t IEEEReal_RoundingMode_FE_UPWARD;
+PRIVATE C_Int_t IEEEReal_setRoundingMode(C_Int_t);
+PRIVATE void MinGW_clearNonBlock(C_Fd_t);
+PRIVATE C_Size_t MinGW_getTempPath(C_Size_t,Array(Char8_t));
+PRIVATE void MinGW_setNonBlock(C_Fd_t);
+PRIVATE __attribute__((noreturn)) void MLton_bug(String8_t);
+PRIVATE extern const C_Int_t MLton_Itimer_PROF;
+PRIVATE extern const C_Int_t MLton_Itimer_REAL;
+PRIVATE C_Errno_t(C_Int_t) MLton_Itimer_set(C_Int_t,C_Time_t,C_SUSeconds_t,C_Time_t,C_SUSeconds_t);
+PRIVATE extern const C_Int_t MLton_Itimer_VIRTUAL;
+PRIVATE C_Errno_t(C_PId_t) MLton_Process_spawne(NullString8_t,Array(NullString8_t),Array(NullString8_t));
+PRIVATE C_Errno_t(C_PId_t) MLton_Process_spawnp(NullString8_t,Array(NullString8_t));
+PRIVATE extern const C_Int_t MLton_Rlimit_AS;
+PRIVATE extern const C_Int_t MLton_Rlimit_CORE;
+PRIVATE extern const C_Int_t MLton_Rlimit_CPU;
+PRIVATE extern const C_Int_t MLton_Rlimit_DATA;
+PRIVATE extern const C_Int_t MLton_Rlimit_FSIZE;
+PRIVATE C_Errno_t(C_Int_t) MLton_Rlimit_get(C_Int_t);
+PRIVATE C_RLim_t MLton_Rlimit_getHard(void);
+PRIVATE C_RLim_t MLton_Rlimit_getSoft(void);
+PRIVATE extern const C_RLim_t MLton_Rlimit_INFINITY;
+PRIVATE extern const C_Int_t MLton_Rlimit_MEMLOCK;
+PRIVATE extern const C_Int_t MLton_Rlimit_NOFILE;
+PRIVATE extern const C_Int_t MLton_Rlimit_NPROC;
+PRIVATE extern const C_Int_t MLton_Rlimit_RSS;
+PRIVATE C_Errno_t(C_Int_t) MLton_Rlimit_set(C_Int_t,C_RLim_t,C_RLim_t);
+PRIVATE extern const C_Int_t MLton_Rlimit_STACK;
+PRIVATE C_Time_t MLton_Rusage_children_stime_sec(GCState_t);
+PRIVATE C_SUSeconds_t MLton_Rusage_children_stime_usec(GCState_t);
+PRIVATE C_Time_t MLton_Rusage_children_utime_sec(GCState_t);
+PRIVATE C_SUSeconds_t MLton_Rusage_children_utime_usec(GCState_t);
+PRIVATE C_Time_t MLton_Rusage_gc_stime_sec(GCState_t);
+PRIVATE C_SUSeconds_t MLton_Rusage_gc_stime_usec(GCState_t);
+PRIVATE C_Time_t MLton_Rusage_gc_utime_sec(GCState_t);
+PRIVATE C_SUSeconds_t MLton_Rusage_gc_utime_usec(GCState_t);
+PRIVATE PRIVATE void MLton_Rusage_getGCRusageOfProc(GCState_t,Int32_t);
+PRIVATE void MLton_Rusage_getrusage(GCState_t);
+PRIVATE C_Time_t MLton_Rusage_self_stime_sec(GCState_t);
+PRIVATE C_SUSeconds_t MLton_Rusage_self_stime_usec(GCState_t);
+PRIVATE C_Time_t MLton_Rusage_self_utime_sec(GCState_t);
+PRIVATE C_SUSeconds_t MLton_Rusage_self_utime_usec(GCState_t);
+PRIVATE void MLton_Syslog_closelog(void);
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_AUTH;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_CRON;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_DAEMON;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_KERN;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_LOCAL0;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_LOCAL1;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_LOCAL2;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_LOCAL3;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_LOCAL4;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_LOCAL5;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_LOCAL6;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_LOCAL7;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_LPR;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_MAIL;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_NEWS;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_SYSLOG;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_USER;
+PRIVATE extern const C_Int_t MLton_Syslog_Facility_LOG_UUCP;
+PRIVATE extern const C_Int_t MLton_Syslog_Logopt_LOG_CONS;
+PRIVATE extern const C_Int_t MLton_Syslog_Logopt_LOG_NDELAY;
+PRIVATE extern const C_Int_t MLton_Syslog_Logopt_LOG_NOWAIT;
+PRIVATE extern const C_Int_t MLton_Syslog_Logopt_LOG_ODELAY;
+PRIVATE extern const C_Int_t MLton_Syslog_Logopt_LOG_PERROR;
+PRIVATE extern const C_Int_t MLton_Syslog_Logopt_LOG_PID;
+PRIVATE void MLton_Syslog_openlog(NullString8_t,C_Int_t,C_Int_t);
+PRIVATE extern const C_Int_t MLton_Syslog_Severity_LOG_ALERT;
+PRIVATE extern const C_Int_t MLton_Syslog_Severity_LOG_CRIT;
+PRIVATE extern const C_Int_t MLton_Syslog_Severity_LOG_DEBUG;
+PRIVATE extern const C_Int_t MLton_Syslog_Severity_LOG_EMERG;
+PRIVATE extern const C_Int_t MLton_Syslog_Severity_LOG_ERR;
+PRIVATE extern const C_Int_t MLton_Syslog_Severity_LOG_INFO;
+PRIVATE extern const C_Int_t MLton_Syslog_Severity_LOG_NOTICE;
+PRIVATE extern const C_Int_t MLton_Syslog_Severity_LOG_WARNING;
+PRIVATE void MLton_Syslog_syslog(C_Int_t,NullString8_t);
+PRIVATE Word32_t Net_htonl(Word32_t);
+PRIVATE Word16_t Net_htons(Word16_t);
+PRIVATE Word32_t Net_ntohl(Word32_t);
+PRIVATE Word16_t Net_ntohs(Word16_t);
+PRIVATE C_Int_t NetHostDB_getByAddress(Vector(Word8_t),C_Socklen_t);
+PRIVATE C_Int_t NetHostDB_getByName(NullString8_t);
+PRIVATE void NetHostDB_getEntryAddrsN(C_Int_t,Array(Word8_t));
+PRIVATE C_Int_t NetHostDB_getEntryAddrsNum(void);
+PRIVATE C_Int_t NetHostDB_getEntryAddrType(void);
+PRIVATE C_String_t NetHostDB_getEntryAliasesN(C_Int_t);
+PRIVATE C_Int_t NetHostDB_getEntryAliasesNum(void);
+PRIVATE C_Int_t NetHostDB_getEntryLength(void);
+PRIVATE C_String_t NetHostDB_getEntryName(void);
+PRIVATE C_Errno_t(C_Int_t) NetHostDB_getHostName(Array(Char8_t),C_Size_t);
+PRIVATE extern const C_Int_t NetHostDB_INADDR_ANY;
+PRIVATE extern const C_Size_t NetHostDB_inAddrSize;
+PRIVATE C_Int_t NetProtDB_getByName(NullString8_t);
+PRIVATE C_Int_t NetProtDB_getByNumber(C_Int_t);
+PRIVATE C_String_t NetProtDB_getEntryAliasesN(C_Int_t);
+PRIVATE C_Int_t NetProtDB_getEntryAliasesNum(void);
+PRIVATE C_String_t NetProtDB_getEntryName(void);
+PRIVATE C_Int_t NetProtDB_getEntryProto(void);
+PRIVATE C_Int_t NetServDB_getByName(NullString8_t,NullString8_t);
+PRIVATE C_Int_t NetServDB_getByNameNull(NullString8_t);
+PRIVATE C_Int_t NetServDB_getByPort(C_Int_t,NullString8_t);
+PRIVATE C_Int_t NetServDB_getByPortNull(C_Int_t);
+PRIVATE C_String_t NetServDB_getEntryAliasesN(C_Int_t);
+PRIVATE C_Int_t NetServDB_getEntryAliasesNum(void);
+PRIVATE C_String_t NetServDB_getEntryName(void);
+PRIVATE C_Int_t NetServDB_getEntryPort(void);
+PRIVATE C_String_t NetServDB_getEntryProto(void);
+PRIVATE C_Errno_t(C_Int_t) OS_IO_poll(Vector(C_Fd_t),Vector(C_Short_t),C_NFds_t,C_Int_t,Array(C_Short_t));
+PRIVATE extern const C_Short_t OS_IO_POLLIN;
+PRIVATE extern const C_Short_t OS_IO_POLLOUT;
+PRIVATE extern const C_Short_t OS_IO_POLLPRI;
+PRIVATE void Posix_Error_clearErrno(void);
+PRIVATE extern const C_Int_t Posix_Error_E2BIG;
+PRIVATE extern const C_Int_t Posix_Error_EACCES;
+PRIVATE extern const C_Int_t Posix_Error_EADDRINUSE;
+PRIVATE extern const C_Int_t Posix_Error_EADDRNOTAVAIL;
+PRIVATE extern const C_Int_t Posix_Error_EAFNOSUPPORT;
+PRIVATE extern const C_Int_t Posix_Error_EAGAIN;
+PRIVATE extern const C_Int_t Posix_Error_EALREADY;
+PRIVATE extern const C_Int_t Posix_Error_EBADF;
+PRIVATE extern const C_Int_t Posix_Error_EBADMSG;
+PRIVATE extern const C_Int_t Posix_Error_EBUSY;
+PRIVATE extern const C_Int_t Posix_Error_ECANCELED;
+PRIVATE extern const C_Int_t Posix_Error_ECHILD;
+PRIVATE extern const C_Int_t Posix_Error_ECONNABORTED;
+PRIVATE extern const C_Int_t Posix_Error_ECONNREFUSED;
+PRIVATE extern const C_Int_t Posix_Error_ECONNRESET;
+PRIVATE extern const C_Int_t Posix_Error_EDEADLK;
+PRIVATE extern const C_Int_t Posix_Error_EDESTADDRREQ;
+PRIVATE extern const C_Int_t Posix_Error_EDOM;
+PRIVATE extern const C_Int_t Posix_Error_EDQUOT;
+PRIVATE extern const C_Int_t Posix_Error_EEXIST;
+PRIVATE extern const C_Int_t Posix_Error_EFAULT;
+PRIVATE extern const C_Int_t Posix_Error_EFBIG;
+PRIVATE extern const C_Int_t Posix_Error_EHOSTUNREACH;
+PRIVATE extern const C_Int_t Posix_Error_EIDRM;
+PRIVATE extern const C_Int_t Posix_Error_EILSEQ;
+PRIVATE extern const C_Int_t Posix_Error_EINPROGRESS;
+PRIVATE extern const C_Int_t Posix_Error_EINTR;
+PRIVATE extern const C_Int_t Posix_Error_EINVAL;
+PRIVATE extern const C_Int_t Posix_Error_EIO;
+PRIVATE extern const C_Int_t Posix_Error_EISCONN;
+PRIVATE extern const C_Int_t Posix_Error_EISDIR;
+PRIVATE extern const C_Int_t Posix_Error_ELOOP;
+PRIVATE extern const C_Int_t Posix_Error_EMFILE;
+PRIVATE extern const C_Int_t Posix_Error_EMLINK;
+PRIVATE extern const C_Int_t Posix_Error_EMSGSIZE;
+PRIVATE extern const C_Int_t Posix_Error_EMULTIHOP;
+PRIVATE extern const C_Int_t Posix_Error_ENAMETOOLONG;
+PRIVATE extern const C_Int_t Posix_Error_ENETDOWN;
+PRIVATE extern const C_Int_t Posix_Error_ENETRESET;
+PRIVATE extern const C_Int_t Posix_Error_ENETUNREACH;
+PRIVATE extern const C_Int_t Posix_Error_ENFILE;
+PRIVATE extern const C_Int_t Posix_Error_ENOBUFS;
+PRIVATE extern const C_Int_t Posix_Error_ENODATA;
+PRIVATE extern const C_Int_t Posix_Error_ENODEV;
+PRIVATE extern const C_Int_t Posix_Error_ENOENT;
+PRIVATE extern const C_Int_t Posix_Error_ENOEXEC;
+PRIVATE extern const C_Int_t Posix_Error_ENOLCK;
+PRIVATE extern const C_Int_t Posix_Error_ENOLINK;
+PRIVATE extern const C_Int_t Posix_Error_ENOMEM;
+PRIVATE extern const C_Int_t Posix_Error_ENOMSG;
+PRIVATE extern const C_Int_t Posix_Error_ENOPROTOOPT;
+PRIVATE extern const C_Int_t Posix_Error_ENOSPC;
+PRIVATE extern const C_Int_t Posix_Error_ENOSR;
+PRIVATE extern const C_Int_t Posix_Error_ENOSTR;
+PRIVATE extern const C_Int_t Posix_Error_ENOSYS;
+PRIVATE extern const C_Int_t Posix_Error_ENOTCONN;
+PRIVATE extern const C_Int_t Posix_Error_ENOTDIR;
+PRIVATE extern const C_Int_t Posix_Error_ENOTEMPTY;
+PRIVATE extern const C_Int_t Posix_Error_ENOTSOCK;
+PRIVATE extern const C_Int_t Posix_Error_ENOTSUP;
+PRIVATE extern const C_Int_t Posix_Error_ENOTTY;
+PRIVATE extern const C_Int_t Posix_Error_ENXIO;
+PRIVATE extern const C_Int_t Posix_Error_EOPNOTSUPP;
+PRIVATE extern const C_Int_t Posix_Error_EOVERFLOW;
+PRIVATE extern const C_Int_t Posix_Error_EPERM;
+PRIVATE extern const C_Int_t Posix_Error_EPIPE;
+PRIVATE extern const C_Int_t Posix_Error_EPROTO;
+PRIVATE extern const C_Int_t Posix_Error_EPROTONOSUPPORT;
+PRIVATE extern const C_Int_t Posix_Error_EPROTOTYPE;
+PRIVATE extern const C_Int_t Posix_Error_ERANGE;
+PRIVATE extern const C_Int_t Posix_Error_EROFS;
+PRIVATE extern const C_Int_t Posix_Error_ESPIPE;
+PRIVATE extern const C_Int_t Posix_Error_ESRCH;
+PRIVATE extern const C_Int_t Posix_Error_ESTALE;
+PRIVATE extern const C_Int_t Posix_Error_ETIME;
+PRIVATE extern const C_Int_t Posix_Error_ETIMEDOUT;
+PRIVATE extern const C_Int_t Posix_Error_ETXTBSY;
+PRIVATE extern const C_Int_t Posix_Error_EWOULDBLOCK;
+PRIVATE extern const C_Int_t Posix_Error_EXDEV;
+PRIVATE C_Int_t Posix_Error_getErrno(void);
+PRIVATE C_String_t Posix_Error_strError(C_Int_t);
+PRIVATE extern const C_Int_t Posix_FileSys_A_F_OK;
+PRIVATE extern const C_Int_t Posix_FileSys_A_R_OK;
+PRIVATE extern const C_Int_t Posix_FileSys_A_W_OK;
+PRIVATE extern const C_Int_t Posix_FileSys_A_X_OK;
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_access(NullString8_t,C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_chdir(NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_chmod(NullString8_t,C_Mode_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_chown(NullString8_t,C_UId_t,C_GId_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_Dirstream_closeDir(C_DirP_t);
+PRIVATE C_Errno_t(C_DirP_t) Posix_FileSys_Dirstream_openDir(NullString8_t);
+PRIVATE C_Errno_t(C_String_t) Posix_FileSys_Dirstream_readDir(C_DirP_t);
+PRIVATE void Posix_FileSys_Dirstream_rewindDir(C_DirP_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_fchdir(C_Fd_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_fchmod(C_Fd_t,C_Mode_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_fchown(C_Fd_t,C_UId_t,C_GId_t);
+PRIVATE C_Errno_t(C_Long_t) Posix_FileSys_fpathconf(C_Fd_t,C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_ftruncate(C_Fd_t,C_Off_t);
+PRIVATE C_Errno_t(C_String_t) Posix_FileSys_getcwd(Array(Char8_t),C_Size_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_link(NullString8_t,NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_mkdir(NullString8_t,C_Mode_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_mkfifo(NullString8_t,C_Mode_t);
+PRIVATE extern const C_Int_t Posix_FileSys_O_APPEND;
+PRIVATE extern const C_Int_t Posix_FileSys_O_BINARY;
+PRIVATE extern const C_Int_t Posix_FileSys_O_CREAT;
+PRIVATE extern const C_Int_t Posix_FileSys_O_DSYNC;
+PRIVATE extern const C_Int_t Posix_FileSys_O_EXCL;
+PRIVATE extern const C_Int_t Posix_FileSys_O_NOCTTY;
+PRIVATE extern const C_Int_t Posix_FileSys_O_NONBLOCK;
+PRIVATE extern const C_Int_t Posix_FileSys_O_RDONLY;
+PRIVATE extern const C_Int_t Posix_FileSys_O_RDWR;
+PRIVATE extern const C_Int_t Posix_FileSys_O_RSYNC;
+PRIVATE extern const C_Int_t Posix_FileSys_O_SYNC;
+PRIVATE extern const C_Int_t Posix_FileSys_O_TEXT;
+PRIVATE extern const C_Int_t Posix_FileSys_O_TRUNC;
+PRIVATE extern const C_Int_t Posix_FileSys_O_WRONLY;
+PRIVATE C_Errno_t(C_Fd_t) Posix_FileSys_open2(NullString8_t,C_Int_t);
+PRIVATE C_Errno_t(C_Fd_t) Posix_FileSys_open3(NullString8_t,C_Int_t,C_Mode_t);
+PRIVATE C_Errno_t(C_Long_t) Posix_FileSys_pathconf(NullString8_t,C_Int_t);
+PRIVATE extern const C_Int_t Posix_FileSys_PC_ALLOC_SIZE_MIN;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_ASYNC_IO;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_CHOWN_RESTRICTED;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_FILESIZEBITS;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_LINK_MAX;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_MAX_CANON;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_MAX_INPUT;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_NAME_MAX;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_NO_TRUNC;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_PATH_MAX;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_PIPE_BUF;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_PRIO_IO;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_REC_INCR_XFER_SIZE;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_REC_MAX_XFER_SIZE;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_REC_MIN_XFER_SIZE;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_REC_XFER_ALIGN;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_SYMLINK_MAX;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_SYNC_IO;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_TWO_SYMLINKS;
+PRIVATE extern const C_Int_t Posix_FileSys_PC_VDISABLE;
+PRIVATE C_Errno_t(C_SSize_t) Posix_FileSys_readlink(NullString8_t,Array(Char8_t),C_Size_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_rename(NullString8_t,NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_rmdir(NullString8_t);
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IFBLK;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IFCHR;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IFDIR;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IFIFO;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IFLNK;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IFMT;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IFREG;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IFSOCK;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IRGRP;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IROTH;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IRUSR;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IRWXG;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IRWXO;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IRWXU;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_ISGID;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_ISUID;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_ISVTX;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IWGRP;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IWOTH;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IWUSR;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IXGRP;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IXOTH;
+PRIVATE extern const C_Mode_t Posix_FileSys_S_IXUSR;
+PRIVATE C_Int_t Posix_FileSys_ST_isBlk(C_Mode_t);
+PRIVATE C_Int_t Posix_FileSys_ST_isChr(C_Mode_t);
+PRIVATE C_Int_t Posix_FileSys_ST_isDir(C_Mode_t);
+PRIVATE C_Int_t Posix_FileSys_ST_isFIFO(C_Mode_t);
+PRIVATE C_Int_t Posix_FileSys_ST_isLink(C_Mode_t);
+PRIVATE C_Int_t Posix_FileSys_ST_isReg(C_Mode_t);
+PRIVATE C_Int_t Posix_FileSys_ST_isSock(C_Mode_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_Stat_fstat(C_Fd_t);
+PRIVATE C_Time_t Posix_FileSys_Stat_getATime(void);
+PRIVATE C_Time_t Posix_FileSys_Stat_getCTime(void);
+PRIVATE C_Dev_t Posix_FileSys_Stat_getDev(void);
+PRIVATE C_GId_t Posix_FileSys_Stat_getGId(void);
+PRIVATE C_INo_t Posix_FileSys_Stat_getINo(void);
+PRIVATE C_Mode_t Posix_FileSys_Stat_getMode(void);
+PRIVATE C_Time_t Posix_FileSys_Stat_getMTime(void);
+PRIVATE C_NLink_t Posix_FileSys_Stat_getNLink(void);
+PRIVATE C_Dev_t Posix_FileSys_Stat_getRDev(void);
+PRIVATE C_Off_t Posix_FileSys_Stat_getSize(void);
+PRIVATE C_UId_t Posix_FileSys_Stat_getUId(void);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_Stat_lstat(NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_Stat_stat(NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_symlink(NullString8_t,NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_truncate(NullString8_t,C_Off_t);
+PRIVATE C_Mode_t Posix_FileSys_umask(C_Mode_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_unlink(NullString8_t);
+PRIVATE void Posix_FileSys_Utimbuf_setAcTime(C_Time_t);
+PRIVATE void Posix_FileSys_Utimbuf_setModTime(C_Time_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_FileSys_Utimbuf_utime(NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_IO_close(C_Fd_t);
+PRIVATE C_Errno_t(C_Fd_t) Posix_IO_dup(C_Fd_t);
+PRIVATE C_Errno_t(C_Fd_t) Posix_IO_dup2(C_Fd_t,C_Fd_t);
+PRIVATE extern const C_Int_t Posix_IO_F_DUPFD;
+PRIVATE extern const C_Int_t Posix_IO_F_GETFD;
+PRIVATE extern const C_Int_t Posix_IO_F_GETFL;
+PRIVATE extern const C_Int_t Posix_IO_F_GETOWN;
+PRIVATE extern const C_Int_t Posix_IO_F_SETFD;
+PRIVATE extern const C_Int_t Posix_IO_F_SETFL;
+PRIVATE extern const C_Int_t Posix_IO_F_SETOWN;
+PRIVATE C_Errno_t(C_Int_t) Posix_IO_fcntl2(C_Fd_t,C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_IO_fcntl3(C_Fd_t,C_Int_t,C_Int_t);
+PRIVATE extern const C_Int_t Posix_IO_FD_CLOEXEC;
+PRIVATE extern const C_Int_t Posix_IO_FLock_F_GETLK;
+PRIVATE extern const C_Short_t Posix_IO_FLock_F_RDLCK;
+PRIVATE extern const C_Int_t Posix_IO_FLock_F_SETLK;
+PRIVATE extern const C_Int_t Posix_IO_FLock_F_SETLKW;
+PRIVATE extern const C_Short_t Posix_IO_FLock_F_UNLCK;
+PRIVATE extern const C_Short_t Posix_IO_FLock_F_WRLCK;
+PRIVATE C_Errno_t(C_Int_t) Posix_IO_FLock_fcntl(C_Fd_t,C_Int_t);
+PRIVATE C_Off_t Posix_IO_FLock_getLen(void);
+PRIVATE C_PId_t Posix_IO_FLock_getPId(void);
+PRIVATE C_Off_t Posix_IO_FLock_getStart(void);
+PRIVATE C_Short_t Posix_IO_FLock_getType(void);
+PRIVATE C_Short_t Posix_IO_FLock_getWhence(void);
+PRIVATE extern const C_Short_t Posix_IO_FLock_SEEK_CUR;
+PRIVATE extern const C_Short_t Posix_IO_FLock_SEEK_END;
+PRIVATE extern const C_Short_t Posix_IO_FLock_SEEK_SET;
+PRIVATE void Posix_IO_FLock_setLen(C_Off_t);
+PRIVATE void Posix_IO_FLock_setPId(C_PId_t);
+PRIVATE void Posix_IO_FLock_setStart(C_Off_t);
+PRIVATE void Posix_IO_FLock_setType(C_Short_t);
+PRIVATE void Posix_IO_FLock_setWhence(C_Short_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_IO_fsync(C_Fd_t);
+PRIVATE C_Errno_t(C_Off_t) Posix_IO_lseek(C_Fd_t,C_Off_t,C_Int_t);
+PRIVATE extern const C_Int_t Posix_IO_O_ACCMODE;
+PRIVATE C_Errno_t(C_Int_t) Posix_IO_pipe(Array(C_Fd_t));
+PRIVATE C_Errno_t(C_SSize_t) Posix_IO_readChar8(C_Fd_t,Array(Char8_t),C_Int_t,C_Size_t);
+PRIVATE C_Errno_t(C_SSize_t) Posix_IO_readWord8(C_Fd_t,Array(Word8_t),C_Int_t,C_Size_t);
+PRIVATE extern const C_Int_t Posix_IO_SEEK_CUR;
+PRIVATE extern const C_Int_t Posix_IO_SEEK_END;
+PRIVATE extern const C_Int_t Posix_IO_SEEK_SET;
+PRIVATE void Posix_IO_setbin(C_Fd_t);
+PRIVATE void Posix_IO_settext(C_Fd_t);
+PRIVATE C_Errno_t(C_SSize_t) Posix_IO_writeChar8Arr(C_Fd_t,Array(Char8_t),C_Int_t,C_Size_t);
+PRIVATE C_Errno_t(C_SSize_t) Posix_IO_writeChar8Vec(C_Fd_t,Vector(Char8_t),C_Int_t,C_Size_t);
+PRIVATE C_Errno_t(C_SSize_t) Posix_IO_writeWord8Arr(C_Fd_t,Array(Word8_t),C_Int_t,C_Size_t);
+PRIVATE C_Errno_t(C_SSize_t) Posix_IO_writeWord8Vec(C_Fd_t,Vector(Word8_t),C_Int_t,C_Size_t);
+PRIVATE C_String_t Posix_ProcEnv_ctermid(void);
+PRIVATE extern C_StringArray_t Posix_ProcEnv_environ;
+PRIVATE C_GId_t Posix_ProcEnv_getegid(void);
+PRIVATE C_String_t Posix_ProcEnv_getenv(NullString8_t);
+PRIVATE C_UId_t Posix_ProcEnv_geteuid(void);
+PRIVATE C_GId_t Posix_ProcEnv_getgid(void);
+PRIVATE C_Errno_t(C_Int_t) Posix_ProcEnv_getgroups(C_Int_t,Array(C_GId_t));
+PRIVATE C_Int_t Posix_ProcEnv_getgroupsN(void);
+PRIVATE C_Errno_t(C_String_t) Posix_ProcEnv_getlogin(void);
+PRIVATE C_PId_t Posix_ProcEnv_getpgrp(void);
+PRIVATE C_PId_t Posix_ProcEnv_getpid(void);
+PRIVATE C_PId_t Posix_ProcEnv_getppid(void);
+PRIVATE C_UId_t Posix_ProcEnv_getuid(void);
+PRIVATE C_Int_t Posix_ProcEnv_isatty(C_Fd_t);
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_C_BIND;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_C_DEV;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_CHAR_TERM;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_FORT_DEV;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_FORT_RUN;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_LOCALEDEF;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_PBS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_PBS_ACCOUNTING;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_PBS_CHECKPOINT;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_PBS_LOCATE;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_PBS_MESSAGE;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_PBS_TRACK;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_SW_DEV;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_UPE;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_2_VERSION;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_ADVISORY_INFO;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_AIO_LISTIO_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_AIO_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_AIO_PRIO_DELTA_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_ARG_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_ASYNCHRONOUS_IO;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_ATEXIT_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_AVPHYS_PAGES;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_BARRIERS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_BC_BASE_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_BC_DIM_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_BC_SCALE_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_BC_STRING_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_CHILD_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_CLK_TCK;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_CLOCK_SELECTION;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_COLL_WEIGHTS_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_CPUTIME;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_DELAYTIMER_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_EXPR_NEST_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_FSYNC;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_GETGR_R_SIZE_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_GETPW_R_SIZE_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_HOST_NAME_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_IOV_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_IPV6;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_JOB_CONTROL;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_LINE_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_LOGIN_NAME_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_MAPPED_FILES;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_MEMLOCK;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_MEMLOCK_RANGE;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_MEMORY_PROTECTION;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_MESSAGE_PASSING;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_MONOTONIC_CLOCK;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_MQ_OPEN_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_MQ_PRIO_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_NGROUPS_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_NPROCESSORS_CONF;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_NPROCESSORS_ONLN;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_OPEN_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_PAGE_SIZE;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_PAGESIZE;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_PHYS_PAGES;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_PRIORITIZED_IO;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_PRIORITY_SCHEDULING;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_RAW_SOCKETS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_RE_DUP_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_READER_WRITER_LOCKS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_REALTIME_SIGNALS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_REGEXP;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_RTSIG_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SAVED_IDS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SEM_NSEMS_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SEM_VALUE_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SEMAPHORES;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SHARED_MEMORY_OBJECTS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SHELL;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SIGQUEUE_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SPAWN;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SPIN_LOCKS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SPORADIC_SERVER;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SS_REPL_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_STREAM_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SYMLOOP_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_SYNCHRONIZED_IO;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_ATTR_STACKADDR;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_ATTR_STACKSIZE;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_CPUTIME;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_DESTRUCTOR_ITERATIONS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_KEYS_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_PRIO_INHERIT;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_PRIO_PROTECT;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_PRIORITY_SCHEDULING;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_PROCESS_SHARED;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_SAFE_FUNCTIONS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_SPORADIC_SERVER;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_STACK_MIN;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREAD_THREADS_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_THREADS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TIMEOUTS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TIMER_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TIMERS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TRACE;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TRACE_EVENT_FILTER;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TRACE_EVENT_NAME_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TRACE_INHERIT;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TRACE_LOG;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TRACE_NAME_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TRACE_SYS_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TRACE_USER_EVENT_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TTY_NAME_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TYPED_MEMORY_OBJECTS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_TZNAME_MAX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_V6_ILP32_OFF32;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_V6_ILP32_OFFBIG;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_V6_LP64_OFF64;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_V6_LPBIG_OFFBIG;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_VERSION;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XBS5_ILP32_OFF32;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XBS5_ILP32_OFFBIG;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XBS5_LP64_OFF64;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XBS5_LPBIG_OFFBIG;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XOPEN_CRYPT;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XOPEN_ENH_I18N;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XOPEN_LEGACY;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XOPEN_REALTIME;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XOPEN_REALTIME_THREADS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XOPEN_SHM;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XOPEN_STREAMS;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XOPEN_UNIX;
+PRIVATE extern const C_Int_t Posix_ProcEnv_SC_XOPEN_VERSION;
+PRIVATE C_Errno_t(C_Int_t) Posix_ProcEnv_setenv(NullString8_t,NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_ProcEnv_setgid(C_GId_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_ProcEnv_setgroups(C_Int_t,Vector(C_GId_t));
+PRIVATE C_Errno_t(C_Int_t) Posix_ProcEnv_setpgid(C_PId_t,C_PId_t);
+PRIVATE C_Errno_t(C_PId_t) Posix_ProcEnv_setsid(void);
+PRIVATE C_Errno_t(C_Int_t) Posix_ProcEnv_setuid(C_UId_t);
+PRIVATE C_Errno_t(C_Long_t) Posix_ProcEnv_sysconf(C_Int_t);
+PRIVATE C_Errno_t(C_Clock_t) Posix_ProcEnv_times(void);
+PRIVATE C_Clock_t Posix_ProcEnv_Times_getCSTime(void);
+PRIVATE C_Clock_t Posix_ProcEnv_Times_getCUTime(void);
+PRIVATE C_Clock_t Posix_ProcEnv_Times_getSTime(void);
+PRIVATE C_Clock_t Posix_ProcEnv_Times_getUTime(void);
+PRIVATE C_Errno_t(C_String_t) Posix_ProcEnv_ttyname(C_Fd_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_ProcEnv_uname(void);
+PRIVATE C_String_t Posix_ProcEnv_Uname_getMachine(void);
+PRIVATE C_String_t Posix_ProcEnv_Uname_getNodeName(void);
+PRIVATE C_String_t Posix_ProcEnv_Uname_getRelease(void);
+PRIVATE C_String_t Posix_ProcEnv_Uname_getSysName(void);
+PRIVATE C_String_t Posix_ProcEnv_Uname_getVersion(void);
+PRIVATE C_UInt_t Posix_Process_alarm(C_UInt_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_Process_exece(NullString8_t,Array(NullString8_t),Array(NullString8_t));
+PRIVATE C_Errno_t(C_Int_t) Posix_Process_execp(NullString8_t,Array(NullString8_t));
+PRIVATE __attribute__((noreturn)) void Posix_Process_exit(C_Status_t);
+PRIVATE C_Int_t Posix_Process_exitStatus(C_Status_t);
+PRIVATE C_Errno_t(C_PId_t) Posix_Process_fork(void);
+PRIVATE C_Int_t Posix_Process_ifExited(C_Status_t);
+PRIVATE C_Int_t Posix_Process_ifSignaled(C_Status_t);
+PRIVATE C_Int_t Posix_Process_ifStopped(C_Status_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_Process_kill(C_PId_t,C_Signal_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_Process_nanosleep(Ref(C_Time_t),Ref(C_Long_t));
+PRIVATE C_Errno_t(C_Int_t) Posix_Process_pause(void);
+PRIVATE C_UInt_t Posix_Process_sleep(C_UInt_t);
+PRIVATE C_Signal_t Posix_Process_stopSig(C_Status_t);
+PRIVATE C_Errno_t(C_Status_t) Posix_Process_system(NullString8_t);
+PRIVATE C_Signal_t Posix_Process_termSig(C_Status_t);
+PRIVATE extern const C_Int_t Posix_Process_W_NOHANG;
+PRIVATE extern const C_Int_t Posix_Process_W_UNTRACED;
+PRIVATE C_Errno_t(C_PId_t) Posix_Process_waitpid(C_PId_t,Ref(C_Status_t),C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_default(GCState_t,C_Signal_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_handlee(GCState_t,C_Signal_t);
+PRIVATE void Posix_Signal_handleGC(GCState_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_ignore(GCState_t,C_Signal_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_isDefault(C_Signal_t,Ref(C_Int_t));
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_isIgnore(C_Signal_t,Ref(C_Int_t));
+PRIVATE C_Int_t Posix_Signal_isPending(GCState_t,C_Signal_t);
+PRIVATE C_Int_t Posix_Signal_isPendingGC(GCState_t);
+PRIVATE extern const C_Int_t Posix_Signal_NSIG;
+PRIVATE void Posix_Signal_resetPending(GCState_t);
+PRIVATE extern const C_Int_t Posix_Signal_SIG_BLOCK;
+PRIVATE extern const C_Int_t Posix_Signal_SIG_SETMASK;
+PRIVATE extern const C_Int_t Posix_Signal_SIG_UNBLOCK;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGABRT;
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_sigaddset(Array(Word8_t),C_Signal_t);
+PRIVATE extern const C_Signal_t Posix_Signal_SIGALRM;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGBUS;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGCHLD;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGCONT;
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_sigdelset(Array(Word8_t),C_Signal_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_sigemptyset(Array(Word8_t));
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_sigfillset(Array(Word8_t));
+PRIVATE extern const C_Signal_t Posix_Signal_SIGFPE;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGHUP;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGILL;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGINT;
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_sigismember(Vector(Word8_t),C_Signal_t);
+PRIVATE extern const C_Signal_t Posix_Signal_SIGKILL;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGPIPE;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGPOLL;
+PRIVATE C_Errno_t(C_Int_t) Posix_Signal_sigprocmask(C_Int_t,Vector(Word8_t),Array(Word8_t));
+PRIVATE extern const C_Signal_t Posix_Signal_SIGPROF;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGQUIT;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGSEGV;
+PRIVATE extern const C_Size_t Posix_Signal_sigSetLen;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGSTOP;
+PRIVATE void Posix_Signal_sigsuspend(Vector(Word8_t));
+PRIVATE extern const C_Signal_t Posix_Signal_SIGSYS;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGTERM;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGTRAP;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGTSTP;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGTTIN;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGTTOU;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGURG;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGUSR1;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGUSR2;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGVTALRM;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGXCPU;
+PRIVATE extern const C_Signal_t Posix_Signal_SIGXFSZ;
+PRIVATE C_Errno_t(C_Int_t) Posix_SysDB_getgrgid(C_GId_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_SysDB_getgrnam(NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_SysDB_getpwnam(NullString8_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_SysDB_getpwuid(C_GId_t);
+PRIVATE C_GId_t Posix_SysDB_Group_getGId(void);
+PRIVATE C_StringArray_t Posix_SysDB_Group_getMem(void);
+PRIVATE C_String_t Posix_SysDB_Group_getName(void);
+PRIVATE C_String_t Posix_SysDB_Passwd_getDir(void);
+PRIVATE C_GId_t Posix_SysDB_Passwd_getGId(void);
+PRIVATE C_String_t Posix_SysDB_Passwd_getName(void);
+PRIVATE C_String_t Posix_SysDB_Passwd_getShell(void);
+PRIVATE C_UId_t Posix_SysDB_Passwd_getUId(void);
+PRIVATE extern const C_Speed_t Posix_TTY_B0;
+PRIVATE extern const C_Speed_t Posix_TTY_B110;
+PRIVATE extern const C_Speed_t Posix_TTY_B1200;
+PRIVATE extern const C_Speed_t Posix_TTY_B134;
+PRIVATE extern const C_Speed_t Posix_TTY_B150;
+PRIVATE extern const C_Speed_t Posix_TTY_B1800;
+PRIVATE extern const C_Speed_t Posix_TTY_B19200;
+PRIVATE extern const C_Speed_t Posix_TTY_B200;
+PRIVATE extern const C_Speed_t Posix_TTY_B2400;
+PRIVATE extern const C_Speed_t Posix_TTY_B300;
+PRIVATE extern const C_Speed_t Posix_TTY_B38400;
+PRIVATE extern const C_Speed_t Posix_TTY_B4800;
+PRIVATE extern const C_Speed_t Posix_TTY_B50;
+PRIVATE extern const C_Speed_t Posix_TTY_B600;
+PRIVATE extern const C_Speed_t Posix_TTY_B75;
+PRIVATE extern const C_Speed_t Posix_TTY_B9600;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_CLOCAL;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_CREAD;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_CS5;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_CS6;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_CS7;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_CS8;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_CSIZE;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_CSTOPB;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_HUPCL;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_PARENB;
+PRIVATE extern const C_TCFlag_t Posix_TTY_C_PARODD;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_BRKINT;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_ICRNL;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_IGNBRK;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_IGNCR;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_IGNPAR;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_INLCR;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_INPCK;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_ISTRIP;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_IXANY;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_IXOFF;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_IXON;
+PRIVATE extern const C_TCFlag_t Posix_TTY_I_PARMRK;
+PRIVATE extern const C_TCFlag_t Posix_TTY_L_ECHO;
+PRIVATE extern const C_TCFlag_t Posix_TTY_L_ECHOE;
+PRIVATE extern const C_TCFlag_t Posix_TTY_L_ECHOK;
+PRIVATE extern const C_TCFlag_t Posix_TTY_L_ECHONL;
+PRIVATE extern const C_TCFlag_t Posix_TTY_L_ICANON;
+PRIVATE extern const C_TCFlag_t Posix_TTY_L_IEXTEN;
+PRIVATE extern const C_TCFlag_t Posix_TTY_L_ISIG;
+PRIVATE extern const C_TCFlag_t Posix_TTY_L_NOFLSH;
+PRIVATE extern const C_TCFlag_t Posix_TTY_L_TOSTOP;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_BS0;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_BS1;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_BSDLY;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_CR0;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_CR1;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_CR2;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_CR3;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_CRDLY;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_FF0;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_FF1;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_FFDLY;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_NL0;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_NL1;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_NLDLY;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_OCRNL;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_OFILL;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_ONLCR;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_ONLRET;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_ONOCR;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_OPOST;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_TAB0;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_TAB1;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_TAB2;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_TAB3;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_TABDLY;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_VT0;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_VT1;
+PRIVATE extern const C_TCFlag_t Posix_TTY_O_VTDLY;
+PRIVATE C_Errno_t(C_Int_t) Posix_TTY_TC_drain(C_Fd_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_TTY_TC_flow(C_Fd_t,C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_TTY_TC_flush(C_Fd_t,C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_TTY_TC_getattr(C_Fd_t);
+PRIVATE C_Errno_t(C_PId_t) Posix_TTY_TC_getpgrp(C_Fd_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_TTY_TC_sendbreak(C_Fd_t,C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_TTY_TC_setattr(C_Fd_t,C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_TTY_TC_setpgrp(C_Fd_t,C_PId_t);
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCIFLUSH;
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCIOFF;
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCIOFLUSH;
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCION;
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCOFLUSH;
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCOOFF;
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCOON;
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCSADRAIN;
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCSAFLUSH;
+PRIVATE extern const C_Int_t Posix_TTY_TC_TCSANOW;
+PRIVATE C_Speed_t Posix_TTY_Termios_cfGetISpeed(void);
+PRIVATE C_Speed_t Posix_TTY_Termios_cfGetOSpeed(void);
+PRIVATE C_Errno_t(C_Int_t) Posix_TTY_Termios_cfSetISpeed(C_Speed_t);
+PRIVATE C_Errno_t(C_Int_t) Posix_TTY_Termios_cfSetOSpeed(C_Speed_t);
+PRIVATE void Posix_TTY_Termios_getCC(Array(C_CC_t));
+PRIVATE C_TCFlag_t Posix_TTY_Termios_getCFlag(void);
+PRIVATE C_TCFlag_t Posix_TTY_Termios_getIFlag(void);
+PRIVATE C_TCFlag_t Posix_TTY_Termios_getLFlag(void);
+PRIVATE C_TCFlag_t Posix_TTY_Termios_getOFlag(void);
+PRIVATE void Posix_TTY_Termios_setCC(Array(C_CC_t));
+PRIVATE void Posix_TTY_Termios_setCFlag(C_TCFlag_t);
+PRIVATE void Posix_TTY_Termios_setIFlag(C_TCFlag_t);
+PRIVATE void Posix_TTY_Termios_setLFlag(C_TCFlag_t);
+PRIVATE void Posix_TTY_Termios_setOFlag(C_TCFlag_t);
+PRIVATE extern const C_Int_t Posix_TTY_V_NCCS;
+PRIVATE extern const C_Int_t Posix_TTY_V_VEOF;
+PRIVATE extern const C_Int_t Posix_TTY_V_VEOL;
+PRIVATE extern const C_Int_t Posix_TTY_V_VERASE;
+PRIVATE extern const C_Int_t Posix_TTY_V_VINTR;
+PRIVATE extern const C_Int_t Posix_TTY_V_VKILL;
+PRIVATE extern const C_Int_t Posix_TTY_V_VMIN;
+PRIVATE extern const C_Int_t Posix_TTY_V_VQUIT;
+PRIVATE extern const C_Int_t Posix_TTY_V_VSTART;
+PRIVATE extern const C_Int_t Posix_TTY_V_VSTOP;
+PRIVATE extern const C_Int_t Posix_TTY_V_VSUSP;
+PRIVATE extern const C_Int_t Posix_TTY_V_VTIME;
+PRIVATE INLINE Real32_t Real32_abs(Real32_t);
+PRIVATE INLINE Real32_t Real32_add(Real32_t,Real32_t);
+PRIVATE INLINE Word32_t Real32_castToWord32(Real32_t);
+PRIVATE INLINE Real32_t Real32_div(Real32_t,Real32_t);
+PRIVATE INLINE Bool_t Real32_equal(Real32_t,Real32_t);
+PRIVATE INLINE Real32_t Real32_fetch(Ref(Real32_t));
+PRIVATE INLINE Real32_t Real32_frexp(Real32_t,Ref(C_Int_t));
+PRIVATE C_String_t Real32_gdtoa(Real32_t,C_Int_t,C_Int_t,C_Int_t,Ref(C_Int_t));
+PRIVATE INLINE Real32_t Real32_ldexp(Real32_t,C_Int_t);
+PRIVATE INLINE Bool_t Real32_le(Real32_t,Real32_t);
+PRIVATE INLINE Bool_t Real32_lt(Real32_t,Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_acos(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_asin(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_atan(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_atan2(Real32_t,Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_cos(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_cosh(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_exp(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_ln(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_log10(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_pow(Real32_t,Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_sin(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_sinh(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_sqrt(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_tan(Real32_t);
+PRIVATE INLINE Real32_t Real32_Math_tanh(Real32_t);
+PRIVATE INLINE Real32_t Real32_modf(Real32_t,Ref(Real32_t));
+PRIVATE INLINE void Real32_move(Ref(Real32_t),Ref(Real32_t));
+PRIVATE INLINE Real32_t Real32_mul(Real32_t,Real32_t);
+PRIVATE INLINE Real32_t Real32_muladd(Real32_t,Real32_t,Real32_t);
+PRIVATE INLINE Real32_t Real32_mulsub(Real32_t,Real32_t,Real32_t);
+PRIVATE INLINE Real32_t Real32_neg(Real32_t);
+PRIVATE INLINE Real32_t Real32_realCeil(Real32_t);
+PRIVATE INLINE Real32_t Real32_realFloor(Real32_t);
+PRIVATE INLINE Real32_t Real32_realTrunc(Real32_t);
+PRIVATE INLINE Real32_t Real32_rndToReal32(Real32_t);
+PRIVATE INLINE Real64_t Real32_rndToReal64(Real32_t);
+PRIVATE INLINE Int16_t Real32_rndToWordS16(Real32_t);
+PRIVATE INLINE Int32_t Real32_rndToWordS32(Real32_t);
+PRIVATE INLINE Int64_t Real32_rndToWordS64(Real32_t);
+PRIVATE INLINE Int8_t Real32_rndToWordS8(Real32_t);
+PRIVATE INLINE Word16_t Real32_rndToWordU16(Real32_t);
+PRIVATE INLINE Word32_t Real32_rndToWordU32(Real32_t);
+PRIVATE INLINE Word64_t Real32_rndToWordU64(Real32_t);
+PRIVATE INLINE Word8_t Real32_rndToWordU8(Real32_t);
+PRIVATE INLINE Real32_t Real32_round(Real32_t);
+PRIVATE INLINE void Real32_store(Ref(Real32_t),Real32_t);
+PRIVATE Real32_t Real32_strtor(NullString8_t,C_Int_t);
+PRIVATE INLINE Real32_t Real32_sub(Real32_t,Real32_t);
+PRIVATE INLINE Real64_t Real64_abs(Real64_t);
+PRIVATE INLINE Real64_t Real64_add(Real64_t,Real64_t);
+PRIVATE INLINE Word64_t Real64_castToWord64(Real64_t);
+PRIVATE INLINE Real64_t Real64_div(Real64_t,Real64_t);
+PRIVATE INLINE Bool_t Real64_equal(Real64_t,Real64_t);
+PRIVATE INLINE Real64_t Real64_fetch(Ref(Real64_t));
+PRIVATE INLINE Real64_t Real64_frexp(Real64_t,Ref(C_Int_t));
+PRIVATE C_String_t Real64_gdtoa(Real64_t,C_Int_t,C_Int_t,C_Int_t,Ref(C_Int_t));
+PRIVATE INLINE Real64_t Real64_ldexp(Real64_t,C_Int_t);
+PRIVATE INLINE Bool_t Real64_le(Real64_t,Real64_t);
+PRIVATE INLINE Bool_t Real64_lt(Real64_t,Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_acos(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_asin(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_atan(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_atan2(Real64_t,Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_cos(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_cosh(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_exp(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_ln(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_log10(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_pow(Real64_t,Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_sin(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_sinh(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_sqrt(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_tan(Real64_t);
+PRIVATE INLINE Real64_t Real64_Math_tanh(Real64_t);
+PRIVATE INLINE Real64_t Real64_modf(Real64_t,Ref(Real64_t));
+PRIVATE INLINE void Real64_move(Ref(Real64_t),Ref(Real64_t));
+PRIVATE INLINE Real64_t Real64_mul(Real64_t,Real64_t);
+PRIVATE INLINE Real64_t Real64_muladd(Real64_t,Real64_t,Real64_t);
+PRIVATE INLINE Real64_t Real64_mulsub(Real64_t,Real64_t,Real64_t);
+PRIVATE INLINE Real64_t Real64_neg(Real64_t);
+PRIVATE INLINE Real64_t Real64_realCeil(Real64_t);
+PRIVATE INLINE Real64_t Real64_realFloor(Real64_t);
+PRIVATE INLINE Real64_t Real64_realTrunc(Real64_t);
+PRIVATE INLINE Real32_t Real64_rndToReal32(Real64_t);
+PRIVATE INLINE Real64_t Real64_rndToReal64(Real64_t);
+PRIVATE INLINE Int16_t Real64_rndToWordS16(Real64_t);
+PRIVATE INLINE Int32_t Real64_rndToWordS32(Real64_t);
+PRIVATE INLINE Int64_t Real64_rndToWordS64(Real64_t);
+PRIVATE INLINE Int8_t Real64_rndToWordS8(Real64_t);
+PRIVATE INLINE Word16_t Real64_rndToWordU16(Real64_t);
+PRIVATE INLINE Word32_t Real64_rndToWordU32(Real64_t);
+PRIVATE INLINE Word64_t Real64_rndToWordU64(Real64_t);
+PRIVATE INLINE Word8_t Real64_rndToWordU8(Real64_t);
+PRIVATE INLINE Real64_t Real64_round(Real64_t);
+PRIVATE INLINE void Real64_store(Ref(Real64_t),Real64_t);
+PRIVATE Real64_t Real64_strtor(NullString8_t,C_Int_t);
+PRIVATE INLINE Real64_t Real64_sub(Real64_t,Real64_t);
+PRIVATE C_Errno_t(C_Int_t) Socket_accept(C_Sock_t,Array(Word8_t),Ref(C_Socklen_t));
+PRIVATE extern const C_Int_t Socket_AF_INET;
+PRIVATE extern const C_Int_t Socket_AF_INET6;
+PRIVATE extern const C_Int_t Socket_AF_UNIX;
+PRIVATE extern const C_Int_t Socket_AF_UNSPEC;
+PRIVATE C_Errno_t(C_Int_t) Socket_bind(C_Sock_t,Vector(Word8_t),C_Socklen_t);
+PRIVATE C_Errno_t(C_Int_t) Socket_close(C_Sock_t);
+PRIVATE C_Errno_t(C_Int_t) Socket_connect(C_Sock_t,Vector(Word8_t),C_Socklen_t);
+PRIVATE C_Errno_t(C_Int_t) Socket_Ctl_getATMARK(C_Sock_t,Ref(C_Int_t));
+PRIVATE C_Errno_t(C_Int_t) Socket_Ctl_getNREAD(C_Sock_t,Ref(C_Int_t));
+PRIVATE C_Errno_t(C_Int_t) Socket_Ctl_getPeerName(C_Sock_t,Array(Word8_t),Ref(C_Socklen_t));
+PRIVATE C_Errno_t(C_Int_t) Socket_Ctl_getSockName(C_Sock_t,Array(Word8_t),Ref(C_Socklen_t));
+PRIVATE C_Errno_t(C_Int_t) Socket_Ctl_getSockOptC_Int(C_Sock_t,C_Int_t,C_Int_t,Ref(C_Int_t));
+PRIVATE C_Errno_t(C_Int_t) Socket_Ctl_getSockOptC_Linger(C_Sock_t,C_Int_t,C_Int_t,Ref(C_Int_t),Ref(C_Int_t));
+PRIVATE C_Errno_t(C_Int_t) Socket_Ctl_setSockOptC_Int(C_Sock_t,C_Int_t,C_Int_t,C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Socket_Ctl_setSockOptC_Linger(C_Sock_t,C_Int_t,C_Int_t,C_Int_t,C_Int_t);
+PRIVATE extern const C_Int_t Socket_Ctl_SO_ACCEPTCONN;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_BROADCAST;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_DEBUG;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_DONTROUTE;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_ERROR;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_KEEPALIVE;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_LINGER;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_OOBINLINE;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_RCVBUF;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_RCVLOWAT;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_RCVTIMEO;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_REUSEADDR;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_SNDBUF;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_SNDLOWAT;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_SNDTIMEO;
+PRIVATE extern const C_Int_t Socket_Ctl_SO_TYPE;
+PRIVATE extern const C_Int_t Socket_Ctl_SOL_SOCKET;
+PRIVATE C_Int_t Socket_familyOfAddr(Vector(Word8_t));
+PRIVATE C_Errno_t(C_Int_t) Socket_GenericSock_socket(C_Int_t,C_Int_t,C_Int_t);
+PRIVATE C_Errno_t(C_Int_t) Socket_GenericSock_socketPair(C_Int_t,C_Int_t,C_Int_t,Array(C_Int_t));
+PRIVATE C_Time_t Socket_getTimeout_sec(void);
+PRIVATE C_SUSeconds_t Socket_getTimeout_usec(void);
+PRIVATE extern const C_Int_t Socket_INetSock_Ctl_IPPROTO_TCP;
+PRIVATE extern const C_Int_t Socket_INetSock_Ctl_TCP_NODELAY;
+PRIVATE void Socket_INetSock_fromAddr(Vector(Word8_t));
+PRIVATE void Socket_INetSock_getInAddr(Array(Word8_t));
+PRIVATE Word16_t Socket_INetSock_getPort(void);
+PRIVATE void Socket_INetSock_toAddr(Vector(Word8_t),Word16_t,Array(Word8_t),Ref(C_Socklen_t));
+PRIVATE C_Errno_t(C_Int_t) Socket_listen(C_Sock_t,C_Int_t);
+PRIVATE extern const C_Int_t Socket_MSG_CTRUNC;
+PRIVATE extern const C_Int_t Socket_MSG_DONTROUTE;
+PRIVATE extern const C_Int_t Socket_MSG_DONTWAIT;
+PRIVATE extern const C_Int_t Socket_MSG_EOR;
+PRIVATE extern const C_Int_t Socket_MSG_OOB;
+PRIVATE extern const C_Int_t Socket_MSG_PEEK;
+PRIVATE extern const C_Int_t Socket_MSG_TRUNC;
+PRIVATE extern const C_Int_t Socket_MSG_WAITALL;
+PRIVATE C_Errno_t(C_SSize_t) Socket_recv(C_Sock_t,Array(Word8_t),C_Int_t,C_Size_t,C_Int_t);
+PRIVATE C_Errno_t(C_SSize_t) Socket_recvFrom(C_Sock_t,Array(Word8_t),C_Int_t,C_Size_t,C_Int_t,Array(Word8_t),Ref(C_Socklen_t));
+PRIVATE C_Errno_t(C_Int_t) Socket_select(Vector(C_Fd_t),Vector(C_Fd_t),Vector(C_Fd_t),Array(C_Int_t),Array(C_Int_t),Array(C_Int_t));
+PRIVATE C_Errno_t(C_SSize_t) Socket_sendArr(C_Sock_t,Array(Word8_t),C_Int_t,C_Size_t,C_Int_t);
+PRIVATE C_Errno_t(C_SSize_t) Socket_sendArrTo(C_Sock_t,Array(Word8_t),C_Int_t,C_Size_t,C_Int_t,Vector(Word8_t),C_Socklen_t);
+PRIVATE C_Errno_t(C_SSize_t) Socket_sendVec(C_Sock_t,Vector(Word8_t),C_Int_t,C_Size_t,C_Int_t);
+PRIVATE C_Errno_t(C_SSize_t) Socket_sendVecTo(C_Sock_t,Vector(Word8_t),C_Int_t,C_Size_t,C_Int_t,Vector(Word8_t),C_Socklen_t);
+PRIVATE void Socket_setTimeout(C_Time_t,C_SUSeconds_t);
+PRIVATE void Socket_setTimeoutNull(void);
+PRIVATE extern const C_Int_t Socket_SHUT_RD;
+PRIVATE extern const C_Int_t Socket_SHUT_RDWR;
+PRIVATE extern const C_Int_t Socket_SHUT_WR;
+PRIVATE C_Errno_t(C_Int_t) Socket_shutdown(C_Sock_t,C_Int_t);
+PRIVATE extern const C_Int_t Socket_SOCK_DGRAM;
+PRIVATE extern const C_Int_t Socket_SOCK_RAW;
+PRIVATE extern const C_Int_t Socket_SOCK_SEQPACKET;
+PRIVATE extern const C_Int_t Socket_SOCK_STREAM;
+PRIVATE extern const C_Size_t Socket_sockAddrStorageLen;
+PRIVATE void Socket_UnixSock_fromAddr(Vector(Word8_t),Array(Char8_t),C_Size_t);
+PRIVATE C_Size_t Socket_UnixSock_pathLen(Vector(Word8_t));
+PRIVATE void Socket_UnixSock_toAddr(NullString8_t,C_Size_t,Array(Word8_t),Ref(C_Socklen_t));
+PRIVATE void Stdio_print(String8_t);
+PRIVATE void Stdio_printStderr(String8_t);
+PRIVATE void Stdio_printStdout(String8_t);
+PRIVATE C_Int_t Time_getTimeOfDay(Ref(C_Time_t),Ref(C_SUSeconds_t));
+PRIVATE C_Errno_t(C_PId_t) Windows_Process_create(NullString8_t,NullString8_t,NullString8_t,C_Fd_t,C_Fd_t,C_Fd_t);
+PRIVATE C_Errno_t(C_PId_t) Windows_Process_createNull(NullString8_t,NullString8_t,C_Fd_t,C_Fd_t,C_Fd_t);
+PRIVATE C_Errno_t(C_Int_t) Windows_Process_getexitcode(C_PId_t,Ref(C_Status_t));
+PRIVATE C_Errno_t(C_Int_t) Windows_Process_terminate(C_PId_t,C_Signal_t);
+PRIVATE INLINE Word16_t Word16_add(Word16_t,Word16_t);
+PRIVATE INLINE Word16_t Word16_andb(Word16_t,Word16_t);
+PRIVATE INLINE Bool_t Word16_equal(Word16_t,Word16_t);
+PRIVATE INLINE Word16_t Word16_lshift(Word16_t,Word32_t);
+PRIVATE INLINE Word16_t Word16_neg(Word16_t);
+PRIVATE INLINE Word16_t Word16_notb(Word16_t);
+PRIVATE INLINE Word16_t Word16_orb(Word16_t,Word16_t);
+PRIVATE INLINE Word16_t Word16_rol(Word16_t,Word32_t);
+PRIVATE INLINE Word16_t Word16_ror(Word16_t,Word32_t);
+PRIVATE INLINE Word16_t Word16_sub(Word16_t,Word16_t);
+PRIVATE INLINE Word16_t Word16_xorb(Word16_t,Word16_t);
+PRIVATE INLINE Word32_t Word32_add(Word32_t,Word32_t);
+PRIVATE INLINE Word32_t Word32_andb(Word32_t,Word32_t);
+PRIVATE INLINE Real32_t Word32_castToReal32(Word32_t);
+PRIVATE INLINE Bool_t Word32_equal(Word32_t,Word32_t);
+PRIVATE INLINE Word32_t Word32_lshift(Word32_t,Word32_t);
+PRIVATE INLINE Word32_t Word32_neg(Word32_t);
+PRIVATE INLINE Word32_t Word32_notb(Word32_t);
+PRIVATE INLINE Word32_t Word32_orb(Word32_t,Word32_t);
+PRIVATE INLINE Word32_t Word32_rol(Word32_t,Word32_t);
+PRIVATE INLINE Word32_t Word32_ror(Word32_t,Word32_t);
+PRIVATE INLINE Word32_t Word32_sub(Word32_t,Word32_t);
+PRIVATE INLINE Word32_t Word32_xorb(Word32_t,Word32_t);
+PRIVATE INLINE Word64_t Word64_add(Word64_t,Word64_t);
+PRIVATE INLINE Word64_t Word64_andb(Word64_t,Word64_t);
+PRIVATE INLINE Real64_t Word64_castToReal64(Word64_t);
+PRIVATE INLINE Bool_t Word64_equal(Word64_t,Word64_t);
+PRIVATE INLINE Word64_t Word64_fetch(Ref(Word64_t));
+PRIVATE INLINE Word64_t Word64_lshift(Word64_t,Word32_t);
+PRIVATE INLINE void Word64_move(Ref(Word64_t),Ref(Word64_t));
+PRIVATE INLINE Word64_t Word64_neg(Word64_t);
+PRIVATE INLINE Word64_t Word64_notb(Word64_t);
+PRIVATE INLINE Word64_t Word64_orb(Word64_t,Word64_t);
+PRIVATE INLINE Word64_t Word64_rol(Word64_t,Word32_t);
+PRIVATE INLINE Word64_t Word64_ror(Word64_t,Word32_t);
+PRIVATE INLINE void Word64_store(Ref(Word64_t),Word64_t);
+PRIVATE INLINE Word64_t Word64_sub(Word64_t,Word64_t);
+PRIVATE INLINE Word64_t Word64_xorb(Word64_t,Word64_t);
+PRIVATE INLINE Word8_t Word8_add(Word8_t,Word8_t);
+PRIVATE INLINE Word8_t Word8_andb(Word8_t,Word8_t);
+PRIVATE INLINE Bool_t Word8_equal(Word8_t,Word8_t);
+PRIVATE INLINE Word8_t Word8_lshift(Word8_t,Word32_t);
+PRIVATE INLINE Word8_t Word8_neg(Word8_t);
+PRIVATE INLINE Word8_t Word8_notb(Word8_t);
+PRIVATE INLINE Word8_t Word8_orb(Word8_t,Word8_t);
+PRIVATE INLINE Word8_t Word8_rol(Word8_t,Word32_t);
+PRIVATE INLINE Word8_t Word8_ror(Word8_t,Word32_t);
+PRIVATE INLINE Word8_t Word8_sub(Word8_t,Word8_t);
+PRIVATE INLINE Word8_t Word8_xorb(Word8_t,Word8_t);
+PRIVATE INLINE Bool_t WordS16_addCheckP(Int16_t,Int16_t);
+PRIVATE INLINE Word16_t WordS16_extdToWord16(Int16_t);
+PRIVATE INLINE Word32_t WordS16_extdToWord32(Int16_t);
+PRIVATE INLINE Word64_t WordS16_extdToWord64(Int16_t);
+PRIVATE INLINE Word8_t WordS16_extdToWord8(Int16_t);
+PRIVATE INLINE Bool_t WordS16_ge(Int16_t,Int16_t);
+PRIVATE INLINE Bool_t WordS16_gt(Int16_t,Int16_t);
+PRIVATE INLINE Bool_t WordS16_le(Int16_t,Int16_t);
+PRIVATE INLINE Bool_t WordS16_lt(Int16_t,Int16_t);
+PRIVATE INLINE Int16_t WordS16_mul(Int16_t,Int16_t);
+PRIVATE INLINE Bool_t WordS16_mulCheckP(Int16_t,Int16_t);
+PRIVATE INLINE Bool_t WordS16_negCheckP(Int16_t);
+PRIVATE INLINE Int16_t WordS16_quot(Int16_t,Int16_t);
+PRIVATE INLINE Int16_t WordS16_rem(Int16_t,Int16_t);
+PRIVATE Real32_t WordS16_rndToReal32(Int16_t);
+PRIVATE Real64_t WordS16_rndToReal64(Int16_t);
+PRIVATE INLINE Int16_t WordS16_rshift(Int16_t,Word32_t);
+PRIVATE INLINE Bool_t WordS16_subCheckP(Int16_t,Int16_t);
+PRIVATE INLINE Bool_t WordS32_addCheckP(Int32_t,Int32_t);
+PRIVATE INLINE Word16_t WordS32_extdToWord16(Int32_t);
+PRIVATE INLINE Word32_t WordS32_extdToWord32(Int32_t);
+PRIVATE INLINE Word64_t WordS32_extdToWord64(Int32_t);
+PRIVATE INLINE Word8_t WordS32_extdToWord8(Int32_t);
+PRIVATE INLINE Bool_t WordS32_ge(Int32_t,Int32_t);
+PRIVATE INLINE Bool_t WordS32_gt(Int32_t,Int32_t);
+PRIVATE INLINE Bool_t WordS32_le(Int32_t,Int32_t);
+PRIVATE INLINE Bool_t WordS32_lt(Int32_t,Int32_t);
+PRIVATE INLINE Int32_t WordS32_mul(Int32_t,Int32_t);
+PRIVATE INLINE Bool_t WordS32_mulCheckP(Int32_t,Int32_t);
+PRIVATE INLINE Bool_t WordS32_negCheckP(Int32_t);
+PRIVATE INLINE Int32_t WordS32_quot(Int32_t,Int32_t);
+PRIVATE INLINE Int32_t WordS32_rem(Int32_t,Int32_t);
+PRIVATE Real32_t WordS32_rndToReal32(Int32_t);
+PRIVATE Real64_t WordS32_rndToReal64(Int32_t);
+PRIVATE INLINE Int32_t WordS32_rshift(Int32_t,Word32_t);
+PRIVATE INLINE Bool_t WordS32_subCheckP(Int32_t,Int32_t);
+PRIVATE INLINE Bool_t WordS64_addCheckP(Int64_t,Int64_t);
+PRIVATE INLINE Word16_t WordS64_extdToWord16(Int64_t);
+PRIVATE INLINE Word32_t WordS64_extdToWord32(Int64_t);
+PRIVATE INLINE Word64_t WordS64_extdToWord64(Int64_t);
+PRIVATE INLINE Word8_t WordS64_extdToWord8(Int64_t);
+PRIVATE INLINE Bool_t WordS64_ge(Int64_t,Int64_t);
+PRIVATE INLINE Bool_t WordS64_gt(Int64_t,Int64_t);
+PRIVATE INLINE Bool_t WordS64_le(Int64_t,Int64_t);
+PRIVATE INLINE Bool_t WordS64_lt(Int64_t,Int64_t);
+PRIVATE INLINE Int64_t WordS64_mul(Int64_t,Int64_t);
+PRIVATE INLINE Bool_t WordS64_mulCheckP(Int64_t,Int64_t);
+PRIVATE INLINE Bool_t WordS64_negCheckP(Int64_t);
+PRIVATE INLINE Int64_t WordS64_quot(Int64_t,Int64_t);
+PRIVATE INLINE Int64_t WordS64_rem(Int64_t,Int64_t);
+PRIVATE Real32_t WordS64_rndToReal32(Int64_t);
+PRIVATE Real64_t WordS64_rndToReal64(Int64_t);
+PRIVATE INLINE Int64_t WordS64_rshift(Int64_t,Word32_t);
+PRIVATE INLINE Bool_t WordS64_subCheckP(Int64_t,Int64_t);
+PRIVATE INLINE Bool_t WordS8_addCheckP(Int8_t,Int8_t);
+PRIVATE INLINE Word16_t WordS8_extdToWord16(Int8_t);
+PRIVATE INLINE Word32_t WordS8_extdToWord32(Int8_t);
+PRIVATE INLINE Word64_t WordS8_extdToWord64(Int8_t);
+PRIVATE INLINE Word8_t WordS8_extdToWord8(Int8_t);
+PRIVATE INLINE Bool_t WordS8_ge(Int8_t,Int8_t);
+PRIVATE INLINE Bool_t WordS8_gt(Int8_t,Int8_t);
+PRIVATE INLINE Bool_t WordS8_le(Int8_t,Int8_t);
+PRIVATE INLINE Bool_t WordS8_lt(Int8_t,Int8_t);
+PRIVATE INLINE Int8_t WordS8_mul(Int8_t,Int8_t);
+PRIVATE INLINE Bool_t WordS8_mulCheckP(Int8_t,Int8_t);
+PRIVATE INLINE Bool_t WordS8_negCheckP(Int8_t);
+PRIVATE INLINE Int8_t WordS8_quot(Int8_t,Int8_t);
+PRIVATE INLINE Int8_t WordS8_rem(Int8_t,Int8_t);
+PRIVATE Real32_t WordS8_rndToReal32(Int8_t);
+PRIVATE Real64_t WordS8_rndToReal64(Int8_t);
+PRIVATE INLINE Int8_t WordS8_rshift(Int8_t,Word32_t);
+PRIVATE INLINE Bool_t WordS8_subCheckP(Int8_t,Int8_t);
+PRIVATE INLINE Bool_t WordU16_addCheckP(Word16_t,Word16_t);
+PRIVATE INLINE Word16_t WordU16_extdToWord16(Word16_t);
+PRIVATE INLINE Word32_t WordU16_extdToWord32(Word16_t);
+PRIVATE INLINE Word64_t WordU16_extdToWord64(Word16_t);
+PRIVATE INLINE Word8_t WordU16_extdToWord8(Word16_t);
+PRIVATE INLINE Bool_t WordU16_ge(Word16_t,Word16_t);
+PRIVATE INLINE Bool_t WordU16_gt(Word16_t,Word16_t);
+PRIVATE INLINE Bool_t WordU16_le(Word16_t,Word16_t);
+PRIVATE INLINE Bool_t WordU16_lt(Word16_t,Word16_t);
+PRIVATE INLINE Word16_t WordU16_mul(Word16_t,Word16_t);
+PRIVATE INLINE Bool_t WordU16_mulCheckP(Word16_t,Word16_t);
+PRIVATE INLINE Bool_t WordU16_negCheckP(Word16_t);
+PRIVATE INLINE Word16_t WordU16_quot(Word16_t,Word16_t);
+PRIVATE INLINE Word16_t WordU16_rem(Word16_t,Word16_t);
+PRIVATE Real32_t WordU16_rndToReal32(Word16_t);
+PRIVATE Real64_t WordU16_rndToReal64(Word16_t);
+PRIVATE INLINE Word16_t WordU16_rshift(Word16_t,Word32_t);
+PRIVATE INLINE Bool_t WordU16_subCheckP(Word16_t,Word16_t);
+PRIVATE INLINE Bool_t WordU32_addCheckP(Word32_t,Word32_t);
+PRIVATE INLINE Word16_t WordU32_extdToWord16(Word32_t);
+PRIVATE INLINE Word32_t WordU32_extdToWord32(Word32_t);
+PRIVATE INLINE Word64_t WordU32_extdToWord64(Word32_t);
+PRIVATE INLINE Word8_t WordU32_extdToWord8(Word32_t);
+PRIVATE INLINE Bool_t WordU32_ge(Word32_t,Word32_t);
+PRIVATE INLINE Bool_t WordU32_gt(Word32_t,Word32_t);
+PRIVATE INLINE Bool_t WordU32_le(Word32_t,Word32_t);
+PRIVATE INLINE Bool_t WordU32_lt(Word32_t,Word32_t);
+PRIVATE INLINE Word32_t WordU32_mul(Word32_t,Word32_t);
+PRIVATE INLINE Bool_t WordU32_mulCheckP(Word32_t,Word32_t);
+PRIVATE INLINE Bool_t WordU32_negCheckP(Word32_t);
+PRIVATE INLINE Word32_t WordU32_quot(Word32_t,Word32_t);
+PRIVATE INLINE Word32_t WordU32_rem(Word32_t,Word32_t);
+PRIVATE Real32_t WordU32_rndToReal32(Word32_t);
+PRIVATE Real64_t WordU32_rndToReal64(Word32_t);
+PRIVATE INLINE Word32_t WordU32_rshift(Word32_t,Word32_t);
+PRIVATE INLINE Bool_t WordU32_subCheckP(Word32_t,Word32_t);
+PRIVATE INLINE Bool_t WordU64_addCheckP(Word64_t,Word64_t);
+PRIVATE INLINE Word16_t WordU64_extdToWord16(Word64_t);
+PRIVATE INLINE Word32_t WordU64_extdToWord32(Word64_t);
+PRIVATE INLINE Word64_t WordU64_extdToWord64(Word64_t);
+PRIVATE INLINE Word8_t WordU64_extdToWord8(Word64_t);
+PRIVATE INLINE Bool_t WordU64_ge(Word64_t,Word64_t);
+PRIVATE INLINE Bool_t WordU64_gt(Word64_t,Word64_t);
+PRIVATE INLINE Bool_t WordU64_le(Word64_t,Word64_t);
+PRIVATE INLINE Bool_t WordU64_lt(Word64_t,Word64_t);
+PRIVATE INLINE Word64_t WordU64_mul(Word64_t,Word64_t);
+PRIVATE INLINE Bool_t WordU64_mulCheckP(Word64_t,Word64_t);
+PRIVATE INLINE Bool_t WordU64_negCheckP(Word64_t);
+PRIVATE INLINE Word64_t WordU64_quot(Word64_t,Word64_t);
+PRIVATE INLINE Word64_t WordU64_rem(Word64_t,Word64_t);
+PRIVATE Real32_t WordU64_rndToReal32(Word64_t);
+PRIVATE Real64_t WordU64_rndToReal64(Word64_t);
+PRIVATE INLINE Word64_t WordU64_rshift(Word64_t,Word32_t);
+PRIVATE INLINE Bool_t WordU64_subCheckP(Word64_t,Word64_t);
+PRIVATE INLINE Bool_t WordU8_addCheckP(Word8_t,Word8_t);
+PRIVATE INLINE Word16_t WordU8_extdToWord16(Word8_t);
+PRIVATE INLINE Word32_t WordU8_extdToWord32(Word8_t);
+PRIVATE INLINE Word64_t WordU8_extdToWord64(Word8_t);
+PRIVATE INLINE Word8_t WordU8_extdToWord8(Word8_t);
+PRIVATE INLINE Bool_t WordU8_ge(Word8_t,Word8_t);
+PRIVATE INLINE Bool_t WordU8_gt(Word8_t,Word8_t);
+PRIVATE INLINE Bool_t WordU8_le(Word8_t,Word8_t);
+PRIVATE INLINE Bool_t WordU8_lt(Word8_t,Word8_t);
+PRIVATE INLINE Word8_t WordU8_mul(Word8_t,Word8_t);
+PRIVATE INLINE Bool_t WordU8_mulCheckP(Word8_t,Word8_t);
+PRIVATE INLINE Bool_t WordU8_negCheckP(Word8_t);
+PRIVATE INLINE Word8_t WordU8_quot(Word8_t,Word8_t);
+PRIVATE INLINE Word8_t WordU8_rem(Word8_t,Word8_t);
+PRIVATE Real32_t WordU8_rndToReal32(Word8_t);
+PRIVATE Real64_t WordU8_rndToReal64(Word8_t);
+PRIVATE INLINE Word8_t WordU8_rshift(Word8_t,Word32_t);
+PRIVATE INLINE Bool_t WordU8_subCheckP(Word8_t,Word8_t);
+#endif /* _MLTON_BASIS_FFI_H_ */
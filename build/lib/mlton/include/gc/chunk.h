@@ -0,0 +1,345 @@
+/* Copyright (C) 2018-2019 Sam Westrick
+ * Copyright (C) 2015 Ram Raghunathan.
+ *
+ * MLton is released under a HPND-style license.
+ * See the file MLton-LICENSE for details.
+ */
+
+
+#ifndef CHUNK_H_
+#define CHUNK_H_
+
+struct HM_chunk;
+struct HM_chunkList;
+typedef struct HM_chunk * HM_chunk;
+typedef struct HM_chunkList * HM_chunkList;
+
+#if (defined (MLTON_GC_INTERNAL_TYPES))
+
+/* SAM_NOTE: Why do I need to declare here? Shouldn't the forwarding functions
+ * be in hierarchical-heap-collection.{c,h}? */
+struct ForwardHHObjptrArgs;
+
+#define CHUNK_INVALID_DEPTH (~((uint32_t)(0)))
+
+#define CHUNK_MAGIC 0xcafeface
+
+/* Chunks are contiguous regions of memory for containing heap-allocated user
+ * (ML) objects. Metadata which is common across all objects within a chunk
+ * are stored in this struct, at the front of the chunk. Each chunk metadata
+ * struct is followed by a certain number of reserved bytes, ending at .limit.
+ * The reserved space up to .frontier contains user data traceable by the GC.
+ * Chunks are built from one or more contiguous blocks. The block size is
+ * fixed at runtime with the `min-chunk` runtime argument.
+ *
+ * A CRUCIAL INVARIANT of chunks is that all constituent objects begin within
+ * the FIRST BLOCK of the chunk. This permits looking up the chunk metadata of
+ * any arbitrary objptr by masking the pointer.
+ *
+ * The heap hierarchy is built from chunks, which are organized into level
+ * lists using the .nextChunk field. Each level list has a "levelhead" chunk,
+ * which is the representative of that level, storing the depth of the level
+ * as well as pointers to other levelheads. Other than storing this data,
+ * levelheads are identical to normal chunks (e.g. they still store user
+ * objects in the reserved space up to .frontier). */
+struct HM_chunk {
+  struct HM_HierarchicalHeap *levelHead;
+
+  pointer frontier; // end of allocations within this chunk
+  pointer limit;    // the end of this chunk
+
+  HM_chunk nextChunk;
+  HM_chunk prevChunk;
+
+  /* some chunks may be used to store other non-ML allocated objects, like
+   * heap records; if so, these will be stored at the front of the chunk, and
+   * the startGap will indicate the amount of space used.
+   * GC-traceable objects begin at
+   *   (pointer)chunk + sizeof(struct HM_chunk) + startGap
+   */
+  uint8_t startGap;
+
+  bool mightContainMultipleObjects;
+
+  /* free chunks only: whether the pages past the first have been returned
+   * to the OS, and when (in ms, wrapping) the chunk was freed. */
+  bool decommitted;
+
+  void* tmpHeap;
+
+  /* during a concurrent collection: bytes of marked objects in this chunk */
+  size_t liveBytes;
+
+  // for padding and sanity checks
+  uint32_t magic;
+  uint32_t freedAt;
+
+} __attribute__((aligned(8)));
+
+struct HM_chunkList {
+  HM_chunk firstChunk;
+  HM_chunk lastChunk;
+
+  size_t size; // size (bytes) of this level, both allocated and unallocated
+} __attribute__((aligned(8)));
+
+/* Each processor indexes its free chunks by size. Bin i holds chunks of
+ * [2^i, 2^(i+1)) blocks, and bit i of nonEmptyBins is set iff bin i is
+ * nonempty, so that finding a large enough chunk is O(1). */
+#define HM_NUM_FREE_BINS 32
+
+struct HM_freeChunkIndex {
+  struct HM_chunkList bins[HM_NUM_FREE_BINS];
+  uint32_t nonEmptyBins;
+  size_t numChunks;
+  size_t numChunksAfterCoalesce;
+  uint32_t lastDecommitPass; // ms, wrapping
+};
+
+/* The shared free pool is split into size classes. Class i holds chunks of
+ * at least 2^i blocks (and fewer than 2^(i+1), except for the last class). */
+#define HM_NUM_SHARED_SIZE_CLASSES 16
+
+/* A batch of free chunks which all belong to the same size class. The batch
+ * descriptor is stored in the free space of the first chunk of the batch, so
+ * pushing a batch onto the shared pool requires no extra allocation. */
+struct HM_chunkBatch {
+  struct HM_chunkBatch* nextBatch;
+  struct HM_chunkList chunks;
+};
+
+/* Free chunks shared between all processors. Each size class is a lock-free
+ * stack of batches. Pushes CAS a batch onto the front; pops swap out the
+ * whole stack, take what they need, and push the remainder back. Swapping
+ * out the whole stack avoids both ABA and reading the descriptor of a batch
+ * that another processor has already reused. */
+struct HM_sharedFreePool {
+  struct HM_chunkBatch* shards[HM_NUM_SHARED_SIZE_CLASSES];
+  size_t size; // approximate total bytes in the pool
+
+  /* Global accounting of chunk memory, maintained atomically. The difference
+   * is an estimate of the resident size of the heap. */
+  size_t bytesMapped;
+  size_t bytesDecommitted;
+
+  uint32_t lastDecommitPass; // ms, wrapping
+};
+
+COMPILE_TIME_ASSERT(HM_chunk__aligned,
+                    (sizeof(struct HM_chunk) % 8) == 0);
+
+#endif /* MLTON_GC_INTERNAL_TYPES */
+
+#if (defined (MLTON_GC_INTERNAL_FUNCS))
+
+// GLOBALS ===================================================================
+
+// Cache values from s->controls for convenience. These are overwritten once
+// by HM_configChunks at program start.
+extern size_t HM_BLOCK_SIZE;
+extern size_t HM_ALLOC_SIZE;
+
+// INLINE FUNCTIONS ==========================================================
+
+static inline pointer blockOf(pointer p) {
+  return (pointer)(uintptr_t)alignDown((size_t)p, HM_BLOCK_SIZE);
+}
+
+static inline bool inSameBlock(pointer p, pointer q) {
+  return blockOf(p) == blockOf(q);
+}
+
+static inline bool inFirstBlockOfChunk(HM_chunk chunk, pointer p) {
+  return p < (pointer)chunk + HM_BLOCK_SIZE;
+}
+
+/* Find the associated chunk metadata of a pointer which is known to point
+ * into the first block of a chunk. */
+static inline HM_chunk HM_getChunkOf(pointer p) {
+  HM_chunk chunk = (HM_chunk)blockOf(p);
+  assert(chunk->magic == CHUNK_MAGIC); // sanity check
+  assert((pointer)chunk + sizeof(struct HM_chunk) <= p);
+
+  /* Must be strictly less than the limit; a pointer at the limit would be
+   * considered a pointer into the next physically adjacent chunk */
+  assert(p < chunk->limit);
+
+  return chunk;
+}
+
+// DECLARATIONS ==============================================================
+
+// Sets the block size and alloc size; called once at program startup.
+void HM_configChunks(GC_state s);
+
+HM_chunk HM_initializeChunk(pointer start, pointer end);
+
+/* Returns a chunk with at least bytesRequested free bytes, not in any list.
+ * Looks in the local free chunk index, then the shared pool, and otherwise
+ * maps new memory. */
+HM_chunk HM_getFreeChunk(GC_state s, size_t bytesRequested);
+
+void HM_initFreeChunkIndex(struct HM_freeChunkIndex* index);
+
+/* Chunks of at most HM_ALLOC_SIZE are handed out from a per-processor
+ * reserve, which is refilled this many chunks at a time. */
+#define HM_ALLOC_RESERVE_BATCH 8
+
+/* Allocate and return a pointer to a new chunk in the list
+ * Requires
+ *   chunk->limit - chunk->frontier <= bytesRequested
+ * Returns NULL if unable to find space for such a chunk. */
+HM_chunk HM_allocateChunk(HM_chunkList list, size_t bytesRequested);
+
+void HM_initChunkList(HM_chunkList list);
+HM_chunkList HM_newChunkList(void);
+
+void HM_deleteChunks(GC_state s, HM_chunkList deleteList);
+
+/* Move all chunks of the list into the shared free pool, where they can be
+ * reused by any processor. The list is empty afterwards. */
+void HM_appendToSharedList(GC_state s, HM_chunkList list);
+
+/* Look in the shared free pool for a chunk with at least bytesRequested free
+ * bytes. The returned chunk is not in any list; other chunks taken from the
+ * pool are moved into the local free lists of s. Returns NULL if no such
+ * chunk was found. */
+HM_chunk HM_checkSharedListForChunk(GC_state s, size_t bytesRequested);
+
+struct HM_sharedFreePool* HM_newSharedFreePool(void);
+void HM_appendChunkList(HM_chunkList destinationChunkList, HM_chunkList chunkList);
+
+void HM_appendChunk(HM_chunkList list, HM_chunk chunk);
+
+/* Remove chunk from this list */
+void HM_unlinkChunk(HM_chunkList list, HM_chunk chunk);
+
+/* Requires: chunk->limit - chunk->frontier >= bytesRequested
+ * Requires: chunk is in the given list
+ *
+ * Attempts to split chunk into two, so that the result chunk contains at
+ * least the requested number of bytes
+ *   BEFORE: ... <-> chunk <-> ...
+ *   AFTER:  ... <-> chunk <-> result <-> ...
+ * if chunk cannot be split as such, returns NULL. */
+HM_chunk HM_splitChunk(HM_chunkList list, HM_chunk chunk, size_t bytesRequested);
+
+/* Requires: left and right are free, and physically adjacent
+ *   (left->limit == right)
+ * Merges right into left. */
+void HM_coalesceChunks(HM_chunk left, HM_chunk right);
+
+/* Merge physically adjacent chunks in the local free chunk index, if
+ * freeListCoalesce is enabled. Meant to be called at the end of a
+ * collection; it only does work once enough chunks have been freed since
+ * the last pass. */
+void HM_coalesceFreeChunks(GC_state s);
+
+/* Return the pages of idle free chunks to the OS. A chunk is idle once it
+ * has been free for the decommitIdleTime control. If the heap is larger
+ * than the maxRSS control, free chunks are decommitted regardless of how
+ * long they have been idle. Meant to be called at the end of a collection. */
+void HM_decommitFreeChunks(GC_state s);
+
+struct HM_HierarchicalHeap* HM_getLevelHeadPathCompress(HM_chunk chunk);
+
+/* Lookup the levelhead for this chunk, but don't path compress. This is useful
+ * for looking up the levelhead of a chunk which might not be locally owned */
+struct HM_HierarchicalHeap* HM_getLevelHead(HM_chunk chunk);
+
+/**
+ * Calls foreachHHObjptrInObject() on every object starting at 'start', which
+ * should be inside a chunk.
+ *
+ * @param s The GC_state to use
+ * @param start The pointer at which the scanning starts. Should point to the
+ * beginning of the metadata of the object.
+ * @param predicate The predicate function to apply to foreachObjptrInObject()
+ * @param the arguments to the predicate function.
+ * @param forwardHHObjptrArgs the args to use for forwardHHObjptr()
+ */
+static inline void HM_forwardHHObjptrsInChunkList(
+  GC_state s,
+  HM_chunk chunk,
+  pointer start,
+  GC_objptrPredicateFun predicate,
+  void *predicateArgs,
+  GC_foreachObjptrFun forwardHHObjptrFunc,
+  struct ForwardHHObjptrArgs* forwardHHObjptrArgs);
+
+/**
+ * This function returns the frontier of the chunk
+ *
+ * @param chunk The chunk to operate on
+ *
+ * @return The frontier of the chunk
+ */
+pointer HM_getChunkFrontier(HM_chunk chunk);
+
+/**
+ * This function returns the limit of the chunk (i.e. the end of the chunk)
+ *
+ * @param chunk The chunk to use
+ *
+ * @return The chunk's limit
+ */
+pointer HM_getChunkLimit(HM_chunk chunk);
+
+/**
+ * This function returns the size of the chunk in bytes.
+ *
+ * @param chunk The chunk to return the size of.
+ *
+ * @return the size of the chunk in bytes.
+ */
+size_t HM_getChunkSize(HM_chunk chunk);
+
+size_t HM_getChunkSizePastFrontier(HM_chunk chunk);
+
+/**
+ * This function returns the start of allocable area of the chunk (pointer to
+ * the first byte that can be allocated), usually used as the initial heap
+ * frontier.
+ *
+ * @param chunk The chunk to use
+ *
+ * @return start of the chunk
+ */
+pointer HM_getChunkStart(HM_chunk chunk);
+
+/* shift the start of the chunk, to store e.g. a heap record.
+ * returns a pointer to the gap, or NULL if no more space is available. */
+pointer HM_shiftChunkStart(HM_chunk chunk, size_t bytes);
+
+/**
+ * This function gets the last chunk in a list
+ *
+ * @param chunkList The list to get the last chunk of
+ *
+ * @return the last chunk, or NULL if the list is empty
+ */
+HM_chunk HM_getChunkListLastChunk(HM_chunkList chunkList);
+HM_chunk HM_getChunkListFirstChunk(HM_chunkList chunkList);
+
+size_t HM_getChunkListSize(HM_chunkList levelHead);
+
+// bool HM_isChunkMarked(HM_chunk chunk);
+// void HM_markChunk(HM_chunk chunk);
+// void HM_unmarkChunk(HM_chunk chunk);
+
+/**
+ * Updates the chunk's values to reflect mutator
+ *
+ * @param chunk The chunk to update
+ * @param frontier The end of the allocations
+ */
+void HM_updateChunkValues(HM_chunk chunk, pointer frontier);
+
+HM_chunkList HM_getChunkList(HM_chunk chunk);
+
+uint32_t HM_getObjptrDepth(objptr op);
+uint32_t HM_getObjptrDepthPathCompress(objptr op);
+
+#endif /* MLTON_GC_INTERNAL_FUNCS */
+
+#endif /* CHUNK_H_ */
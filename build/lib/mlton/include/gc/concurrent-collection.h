@@ -0,0 +1,103 @@
+/**
+ * @file hierarchical-heap-collection.h
+ *
+ * @author Jatin Arora
+ *
+ * @brief
+ * Definition of the concurrent collection interface
+ */
+
+#ifndef CONCURRENT_COLLECTION_H_
+#define CONCURRENT_COLLECTION_H_
+
+#include "concurrent-stack.h"
+#include "hierarchical-heap.h"
+#include "objptr.h"
+#include "deferred-promote.h"
+// #include "logger.h"
+
+
+#if (defined (MLTON_GC_INTERNAL_FUNCS))
+#define LL_Log LL_FORCE
+// A worker's private stack of objects whose mark bit it has flipped but
+// whose fields it has not yet scanned.
+typedef struct CC_markStack {
+	pointer* items;
+	size_t size;
+	size_t capacity;
+} CC_markStack;
+
+// Struct to pass around args. repList is the new chunklist.
+// Every worker taking part in a collection has its own copy, differing only
+// in markStack.
+typedef struct ConcurrentCollectArgs {
+	HM_chunkList origList;
+	HM_chunkList repList;
+	void* toHead;
+	void* fromHead;
+	// Guards origList and repList when several workers save chunks; NULL if
+	// the collection is not shared.
+	spinlock_t* listLock;
+	CC_markStack* markStack;
+	// Applied to every objptr field of each object popped from markStack.
+	GC_foreachObjptrFun scanFun;
+	// Non-NULL while the unmarking pass of a root collection hash-conses.
+	struct CC_shareTable* shareTable;
+} ConcurrentCollectArgs;
+
+
+enum CCState{
+	CC_UNREG,
+	CC_REG,
+	CC_COLLECTING
+};
+
+typedef struct ConcurrentPackage {
+//  It is possible that the collection turned off and the stack isn't empty
+//	This is a result of the non-atomicity in the write barrier implementation
+//	from checking of isCollecting to addition into the stack
+	CC_stack* rootList;
+	//children roots
+	objptr snapLeft;
+	objptr snapRight;
+	objptr snapTemp;
+	// bool isCollecting;
+	bool shouldCollect;
+	enum CCState ccstate;
+	objptr stack;
+	size_t bytesAllocatedSinceLastCollection;
+	size_t bytesSurvivedLastCollection;
+	// Dead bytes in the sparse chunks that the last collection kept. A local
+	// collection that reaches this heap evacuates them.
+	size_t bytesDeadInSparseChunks;
+	struct HM_chunkList remSet;
+} * ConcurrentPackage;
+
+// Assume complete access in this function
+// This function constructs a HM_chunkList of reachable chunks without copying them
+// Then it adds the remaining chunks to the free list.
+// The collections here proceeds here at the chunk level of granularity. i.e if one obj
+// in the chunk is live then the whole chunk is. However, tracing is at the granularity of objects.
+// Objects in chunks that are preserved may point to chunks that are not. But such objects aren't
+// reachable.
+void CC_collectWithRoots(GC_state s, struct HM_HierarchicalHeap * targetHH, GC_thread thread);
+
+void CC_collectAtPublicLevel(GC_state s, GC_thread thread, uint32_t depth);
+
+// Called by idle workers. If a root collection is tracing, helps it until
+// there is no more tracing work to share.
+void CC_helpCollectAtRoot(void);
+void CC_addToStack(ConcurrentPackage cp, pointer p);
+
+// Hash-cons the root heap during the next root collection, even if
+// hashConsDuringGC is off.
+void CC_requestShare(void);
+void CC_initStack(ConcurrentPackage cp);
+
+
+bool CC_isPointerMarked (pointer p);
+void printObjPtrFunction(GC_state s, objptr* opp, void* rawArgs);
+void CC_clearMutationStack(ConcurrentPackage cp);
+#endif
+
+#endif
\ No newline at end of file
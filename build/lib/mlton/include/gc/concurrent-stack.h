@@ -0,0 +1,56 @@
+#ifndef CC_STACK_H
+#define CC_STACK_H
+
+#if (defined (MLTON_GC_INTERNAL_FUNCS))
+
+/* The stack is a list of fixed-size segments, newest first. Pushers claim a
+ * slot in the newest segment with a fetch-and-add; when that segment is
+ * full, a larger one is allocated and installed with a CAS. Segments are
+ * never resized, so pushed data is never copied.
+ *
+ * Pushes come from write barriers on any processor, and may race with the
+ * owner clearing the stack for a new collection. Pushers announce
+ * themselves in `pushers`, and a clear raises `clearing` and waits for
+ * every announced pusher to finish, so each push lands either entirely
+ * before the clear (and is discarded) or entirely after it. Pushers only
+ * wait while a clear is in progress. */
+typedef struct CC_stackSegment {
+    struct CC_stackSegment* next; // next older segment
+    size_t capacity;
+    // Number of slots claimed by pushers. May exceed capacity, in which case
+    // the extra claims failed and were retried on a newer segment.
+    size_t reserved;
+    // Number of slots visited by the current forEachObjptrinStack pass.
+    size_t scanned;
+    // Slots are NULL until written.
+    void* storage[];
+}
+CC_stackSegment;
+
+typedef struct CC_stack {
+    CC_stackSegment* top;
+    // Number of pushes in progress.
+    size_t pushers;
+    // Set while CC_stack_clear runs; pushers wait for it to drop.
+    bool clearing;
+}
+CC_stack;
+
+void CC_stack_init(CC_stack* stack, size_t capacity);
+
+bool CC_stack_push(CC_stack* stack, void* datum);
+
+size_t CC_stack_size(CC_stack* stack);
+
+size_t CC_stack_capacity(CC_stack* stack);
+
+void CC_stack_free(CC_stack* stack);
+void CC_stack_clear(CC_stack* stack);
+
+void forEachObjptrinStack(GC_state s,
+                          CC_stack* stack,
+                          GC_foreachObjptrFun f,
+                          void* rawArgs);
+
+#endif /* CC_STACK_H */
+#endif
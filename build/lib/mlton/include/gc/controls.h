@@ -0,0 +1,82 @@
+/* Copyright (C) 2017 Matthew Fluet.
+ * Copyright (C) 1999-2005 Henry Cejtin, Matthew Fluet, Suresh
+ *    Jagannathan, and Stephen Weeks.
+ * Copyright (C) 1997-2000 NEC Research Institute.
+ *
+ * MLton is released under a HPND-style license.
+ * See the file MLton-LICENSE for details.
+ */
+
+#if (defined (MLTON_GC_INTERNAL_TYPES))
+
+struct GC_ratios {
+  float ramSlop;
+  float stackCurrentGrow;
+  float stackCurrentMaxReserved;
+  float stackCurrentPermitReserved;
+  float stackCurrentShrink;
+  float stackMaxReserved;
+  float stackShrink;
+};
+
+/**
+ * Ratios for Hierarchical Heap operations
+ */
+struct HM_HierarchicalHeapConfig {
+  /* when (bytesAllocatedSinceLastCollection / bytesSurvivedLastCollection)
+   * crosses this threshold, a local collection may be triggered. */
+  double collectionThresholdRatio;
+
+  /* the smallest amount of allocated data that can be collected in a
+   * local collection */
+  size_t minCollectionSize;
+
+  /* the shallowest depth that will be claimed for a local
+   * collection. */
+  uint32_t minLocalDepth;
+};
+
+enum GC_CollectionType {
+  ALL,
+  LOCAL,
+  SUPERLOCAL,
+  NONE
+};
+
+enum SummaryFormat {
+  HUMAN,
+  JSON
+};
+
+struct GC_controls {
+  bool mayLoadWorld;
+  bool mayProcessAtMLton;
+  bool messages; /* Print a message at the start and end of each gc. */
+  size_t allocChunkSize;
+  size_t blockSize;
+  bool freeListCoalesce; /* merge adjacent free chunks after collections */
+  uint32_t decommitIdleTime; /* ms before a free chunk is returned to the OS; 0 = never */
+  size_t maxRSS; /* decommit free chunks eagerly above this heap size; 0 = no cap */
+  bool hashConsDuringGC; /* share duplicate immutable objects in root CCs */
+  bool setAffinity; /* whether or not to set processor affinity */
+  int32_t affinityBase; /* First processor to use when setting affinity */
+  int32_t affinityStride; /* Number of processors between first and second */
+  struct GC_ratios ratios;
+  struct HM_HierarchicalHeapConfig hhConfig;
+  bool rusageMeasureGC;
+  bool summary; /* Print a summary of gc info when program exits. */
+  enum SummaryFormat summaryFormat;
+  FILE* summaryFile;
+  enum GC_CollectionType collectionType;
+  /* Size of the trace buffer */
+  size_t traceBufferSize;
+};
+
+#endif /* (defined (MLTON_GC_INTERNAL_TYPES)) */
+
+#if (defined (MLTON_GC_INTERNAL_FUNCS))
+
+static inline bool detailedGCTime (GC_state s);
+static inline bool needGCTime (GC_state s);
+
+#endif /* (defined (MLTON_GC_INTERNAL_FUNCS)) */
@@ -0,0 +1,25 @@
+/* Copyright (C) 2018-2019 Sam Westrick.
+ *
+ * MLton is released under a HPND-style license.
+ * See the file MLton-LICENSE for details.
+ */
+
+#ifndef DEFERRED_PROMOTE_H
+#define DEFERRED_PROMOTE_H
+#if (defined (MLTON_GC_INTERNAL_FUNCS))
+
+void HM_deferredPromote(
+  GC_state s,
+  GC_thread thread,
+  HM_chunkList globalDownPtrs,
+  struct ForwardHHObjptrArgs* args);
+
+/* Copy the entries of remSet that are still valid into buckets, dropping
+ * duplicates. If byDepth, each entry goes to buckets[depth of its dst];
+ * otherwise all entries go to buckets[0]. */
+void HM_bucketValidRemembered(
+  HM_chunkList remSet,
+  HM_chunkList buckets,
+  bool byDepth);
+#endif  /* defined (MLTON_GC_INTERNAL_FUNCS) */
+#endif  /* DEFERRED_PROMOTE_H */
@@ -0,0 +1,52 @@
+/* Copyright (C) 2018,2019 Sam Westrick
+ *
+ * MLton is released under a HPND-style license.
+ * See the file MLton-LICENSE for details.
+ */
+
+#ifndef REMEMBERED_SET_H_
+#define REMEMBERED_SET_H_
+
+
+#if (defined (MLTON_GC_INTERNAL_TYPES))
+
+/* Remembering *field = src
+ * field must be an internal pointer of dst
+ *
+ * Entries are laid out back-to-back in the chunks of a remembered set, so a
+ * chunk's [start, frontier) range can be walked as a plain array. */
+struct HM_remembered {
+  objptr dst;
+  objptr* field;
+  objptr src;
+};
+
+/* Number of trailing entries HM_remember checks for an identical entry
+ * before appending a new one. */
+#define HM_REMEMBER_DEDUP_WINDOW 8
+
+/* Size of the direct-mapped field filter used to drop duplicate entries when
+ * remembered sets are bucketed. Must be a power of two. */
+#define HM_REMEMBER_FILTER_SIZE 256
+
+typedef void (*HM_foreachDownptrFun)(GC_state s, objptr dst, objptr* field, objptr src, void* args);
+
+typedef struct HM_foreachDownptrClosure {
+  HM_foreachDownptrFun fun;
+  void *env;
+} *HM_foreachDownptrClosure;
+
+#endif /* defined (MLTON_GC_INTERNAL_TYPES) */
+
+
+#if (defined (MLTON_GC_INTERNAL_BASIS))
+
+void HM_remember(HM_chunkList remSet, objptr dst, objptr* field, objptr src);
+void HM_rememberAtLevel(HM_HierarchicalHeap hh, objptr dst, objptr* field, objptr src);
+void HM_foreachRemembered(GC_state s, HM_chunkList remSet, HM_foreachDownptrClosure f);
+size_t HM_numRemembered(HM_chunkList remSet);
+
+#endif /* defined (MLTON_GC_INTERNAL_BASIS) */
+
+
+#endif /* REMEMBERED_SET_H_ */
@@ -0,0 +1,17 @@
+/* Copyright (C) 2017 Ram Raghunathan
+ *
+ * MLton is released under a HPND-style license.
+ * See the file MLton-LICENSE for details.
+ */
+
+#ifndef TLS_OBJECTS_H_
+#define TLS_OBJECTS_H_
+
+struct TLSObjects {
+  struct rusage MLton_Rusage_self;
+  struct rusage MLton_Rusage_children;
+  struct rusage MLton_Rusage_gc;
+  struct drand48_data drand48_data;
+};
+
+#endif /* TLS_OBJECTS_H_ */
@@ -0,0 +1,46 @@
+#include <fenv.h>
+#include <inttypes.h>
+#include <stdint.h>
+
+#include <unistd.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <grp.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <pwd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/sysctl.h>
+#include <sys/time.h>
+#include <sys/resource.h> /* <sys/resource.h> might not #include <sys/time.h> */
+#include <sys/times.h>
+#include <sys/un.h>
+#include <sys/utsname.h>
+#include <sys/wait.h>
+#include <syslog.h>
+#include <termios.h>
+#include <ucontext.h>
+#include <utime.h>
+
+#define HAS_FEROUND TRUE
+#define HAS_MSG_DONTWAIT TRUE
+#define HAS_REMAP FALSE
+#define HAS_SIGALTSTACK TRUE
+#define NEEDS_SIGALTSTACK_EXEC FALSE
+#define HAS_SPAWN FALSE
+#define HAS_TIME_PROFILING TRUE
+
+#define MLton_Platform_OS_host "freebsd"
+
+/* This is probably debian specific, since freebsd worked w/o it before. */
+#if (defined (__FreeBSD_kernel__))
+#define getpgrp() getpgrp(getpid())
+#endif
+
+extern char **environ; /* for Posix_ProcEnv_environ */
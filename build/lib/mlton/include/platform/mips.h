@@ -0,0 +1 @@
+#define MLton_Platform_Arch_host "mips"
@@ -0,0 +1 @@
+int setenv (const char *name, const char *value, int overwrite);
@@ -0,0 +1,58 @@
+#include <inttypes.h>
+#include <stdint.h>
+#include <fenv.h>
+
+#include <unistd.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <grp.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netinet/udp.h>
+#include <poll.h>
+#include <pwd.h>
+#include <sys/filio.h> /* For FIONBIO, FIONREAD. */
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+/* This is defined in <sys/mman.h>, bet we'll redefine it in export.h. */
+#undef PRIVATE
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/sockio.h> /* For SIOCATMARK. */
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/times.h>
+#include <sys/un.h>
+#include <sys/utsname.h>
+#include <sys/wait.h>
+#include <syslog.h>
+#include <termios.h>
+#include <ucontext.h>
+#include <utime.h>
+
+#define HAS_FEROUND TRUE
+#define HAS_MSG_DONTWAIT TRUE
+#define HAS_REMAP FALSE
+#define HAS_SIGALTSTACK TRUE
+#define NEEDS_SIGALTSTACK_EXEC FALSE
+#define HAS_SPAWN FALSE
+#define HAS_TIME_PROFILING TRUE
+
+#define MLton_Platform_OS_host "solaris"
+
+/* ------------------------------------------------- */
+/*                  Posix.ProcEnv                    */
+/* ------------------------------------------------- */
+
+extern char **environ;
+
+/* ------------------------------------------------- */
+/*                  MLton.Syslog                     */
+/* ------------------------------------------------- */
+
+#ifndef LOG_AUTHPRIV
+#define LOG_AUTHPRIV LOG_AUTH
+#endif
+#define LOG_PERROR 0
@@ -0,0 +1,10 @@
+/* Copyright (C) 2004-2008 Henry Cejtin, Matthew Fluet, Suresh
+ *    Jagannathan, and Stephen Weeks.
+ *
+ * MLton is released under a HPND-style license.
+ * See the file MLton-LICENSE for details.
+ */
+
+PRIVATE const char* boolToString (bool b);
+PRIVATE char* intmaxToCommaString (intmax_t n);
+PRIVATE char* uintmaxToCommaString (uintmax_t n);
@@ -83,9 +83,51 @@ Real64 ArrayR64_cas(Real64* a, Word64 i, Real64 x, Real64 y) {
 #define ArrayP_cas(a, i, x, y) __sync_val_compare_and_swap(((Objptr*)(a)) + (i), (x), (y))
 #define ArrayQ_cas(a, i, x, y) __sync_val_compare_and_swap(((CPointer*)(a)) + (i), (x), (y))
 
+/* ------------------------------------------------- */
+/*                 Write barrier                     */
+/* ------------------------------------------------- */
+
+/* Must match struct GC_writeBarrierInfo in gc/assign.h. */
+struct GC_writeBarrierInfo {
+  uintptr_t blockMask;
+  uintptr_t nonObjptrMask;
+  uintptr_t depthOffset;
+  uintptr_t concurrentPackOffset;
+  uintptr_t ccstateOffset;
+};
+
+PRIVATE extern struct GC_writeBarrierInfo GC_writeBarrierInfo;
 extern void Assignable_writeBarrier(CPointer, Objptr, Objptr*, Objptr);
 
+/* The heap of the chunk containing p, or NULL if the chunk's levelHead is
+ * not the representative of its level. The levelHead of a chunk and the
+ * representative of a heap are both at offset 0. */
+static inline Pointer GC_barrierLevelHead(Pointer p) {
+  Pointer hh =
+    *(Pointer*)((uintptr_t)p & GC_writeBarrierInfo.blockMask);
+  return (NULL == *(Pointer*)hh) ? hh : NULL;
+}
+
+/* Most stores are internal or up-pointers while no concurrent collection is
+ * registered, and need nothing from the barrier. Check for that here, and
+ * leave everything else to Assignable_writeBarrier. */
 static inline void GC_writeBarrier(CPointer s, Objptr obj, CPointer dst, Objptr src) {
+  const struct GC_writeBarrierInfo *info = &GC_writeBarrierInfo;
+  Pointer dstHH = GC_barrierLevelHead(obj);
+  if (Expect(NULL == dstHH, 0))
+    goto slow;
+  Pointer cp = *(Pointer*)(dstHH + info->concurrentPackOffset);
+  if (Expect(NULL != cp && 0 != *(Word32*)(cp + info->ccstateOffset), 0))
+    goto slow;
+  if (0 != ((uintptr_t)src & info->nonObjptrMask))
+    return;
+  Pointer srcHH = GC_barrierLevelHead(src);
+  if (Expect(NULL == srcHH, 0))
+    goto slow;
+  if (Expect(*(Word32*)(dstHH + info->depthOffset)
+             >= *(Word32*)(srcHH + info->depthOffset), 1))
+    return;
+slow:
   Assignable_writeBarrier(s, obj, dst, src);
 }
 
@@ -9,6 +9,46 @@
 
 #define cas(F, O, N) ((__sync_val_compare_and_swap(F, O, N)))
 
+COMPILE_TIME_ASSERT(HM_chunk__levelHead_first,
+                    offsetof(struct HM_chunk, levelHead) == 0);
+COMPILE_TIME_ASSERT(HM_HierarchicalHeap__representative_first,
+                    offsetof(struct HM_HierarchicalHeap, representative) == 0);
+COMPILE_TIME_ASSERT(HM_HierarchicalHeap__depth_is_32,
+                    sizeof(((HM_HierarchicalHeap)0)->depth) == 4);
+COMPILE_TIME_ASSERT(ConcurrentPackage__ccstate_is_32,
+                    sizeof(enum CCState) == 4);
+COMPILE_TIME_ASSERT(CC_UNREG__is_zero, CC_UNREG == 0);
+
+/* blockMask is filled in by HM_configChunks, once the block size is known. */
+struct GC_writeBarrierInfo GC_writeBarrierInfo = {
+  .blockMask = 0,
+  .nonObjptrMask =
+    ~((~((uintptr_t)0)) << (GC_MODEL_MINALIGN_SHIFT - GC_MODEL_OBJPTR_SHIFT)),
+  .depthOffset = offsetof(struct HM_HierarchicalHeap, depth),
+  .concurrentPackOffset = offsetof(struct HM_HierarchicalHeap, concurrentPack),
+  .ccstateOffset = offsetof(struct ConcurrentPackage, ccstate)
+};
+
+/* Level head of a chunk, for the write barrier. In the common case the
+ * chunk's levelHead is already the representative of its level, which costs
+ * two loads and no stores; only otherwise do we fall back on the
+ * path-compressing lookup. */
+static inline HM_HierarchicalHeap barrierLevelHead(HM_chunk chunk) {
+  HM_HierarchicalHeap hh = chunk->levelHead;
+  assert(NULL != hh);
+  if (NULL == hh->representative)
+    return hh;
+  return HM_getLevelHeadPathCompress(chunk);
+}
+
+/* The mutation stack of a heap is cleared when a concurrent collection is
+ * registered for it, so values overwritten before then need not be
+ * recorded. */
+static inline bool barrierCCActive(HM_HierarchicalHeap hh) {
+  ConcurrentPackage cp = hh->concurrentPack;
+  return (NULL != cp) && (CC_UNREG != cp->ccstate);
+}
+
 void Assignable_writeBarrier(GC_state s, objptr dst, objptr* field, objptr src) {
   assert(isObjptr(dst));
   pointer dstp = objptrToPointer(dst, NULL);
@@ -48,11 +88,15 @@ void Assignable_writeBarrier(GC_state s, objptr dst, objptr* field, objptr src)
    * down-pointers. */
 
 
-  HM_HierarchicalHeap dstHH = HM_getLevelHeadPathCompress(HM_getChunkOf(dstp));
+  HM_HierarchicalHeap dstHH = barrierLevelHead(HM_getChunkOf(dstp));
 
 
   objptr readVal = *field;
-  if (dstHH->depth >= 1 && isObjptr(readVal) && s->wsQueueTop!=BOGUS_OBJPTR) {
+  if (dstHH->depth >= 1 &&
+      barrierCCActive(dstHH) &&
+      isObjptr(readVal) &&
+      s->wsQueueTop!=BOGUS_OBJPTR)
+  {
     // check for the case where this is laggy
     // uint64_t topval = *(uint64_t*)objptrToPointer(s->wsQueueTop, NULL);
     // uint32_t shallowestPrivateLevel = UNPACK_IDX(topval);
@@ -60,7 +104,7 @@ void Assignable_writeBarrier(GC_state s, objptr dst, objptr* field, objptr src)
     // printf("%d\n", dstHH->depth);
     // Need to remember for all levels
     pointer currp = objptrToPointer(readVal, NULL);
-    HM_HierarchicalHeap currHH = HM_getLevelHead(HM_getChunkOf(currp));
+    HM_HierarchicalHeap currHH = barrierLevelHead(HM_getChunkOf(currp));
 
     // bool z = cas(&(dstHH->concurrentPack->isCollecting), false, false);
     // assert(!z);
@@ -100,7 +144,7 @@ void Assignable_writeBarrier(GC_state s, objptr dst, objptr* field, objptr src)
     return;
 
   pointer srcp = objptrToPointer(src, NULL);
-  HM_HierarchicalHeap srcHH = HM_getLevelHeadPathCompress(HM_getChunkOf(srcp));
+  HM_HierarchicalHeap srcHH = barrierLevelHead(HM_getChunkOf(srcp));
   // if (dstHH->depth >= srcHH->depth) {
   //   if(HM_HH_isCCollecting(srcHH)) {
   //     if (!CC_isPointerMarked(srcp)) {
@@ -109,7 +153,7 @@ void Assignable_writeBarrier(GC_state s, objptr dst, objptr* field, objptr src)
   //   }
   // }
   /* Internal or up-pointer. */
-  if (dstHH->depth >= srcHH->depth){
+  if (dstHH->depth >= srcHH->depth) {
     return;
   }
 
@@ -130,6 +174,7 @@ void Assignable_writeBarrier(GC_state s, objptr dst, objptr* field, objptr src)
     return;
   }
   HM_rememberAtLevel(hh, dst, field, src);
+  s->cumulativeStatistics->numDownPtrsRemembered++;
 
   /* SAM_NOTE: TODO: track bytes allocated here in
    * thread->bytesAllocatedSinceLast...? */
@@ -9,8 +9,26 @@
 #ifndef ASSIGN_H
 #define ASSIGN_H
 
+#if (defined (MLTON_GC_INTERNAL_TYPES))
+
+/* The parts of the heap layout used by the inline write barrier in
+ * c-chunk.h, which declares an identical struct. Offsets are in bytes. The
+ * levelHead of a chunk and the representative of a heap are both at offset
+ * 0, which assign.c checks. */
+struct GC_writeBarrierInfo {
+  uintptr_t blockMask;            /* clears the offset within a block */
+  uintptr_t nonObjptrMask;        /* nonzero bits mean "not an objptr" */
+  uintptr_t depthOffset;          /* of HM_HierarchicalHeap.depth */
+  uintptr_t concurrentPackOffset; /* of HM_HierarchicalHeap.concurrentPack */
+  uintptr_t ccstateOffset;        /* of ConcurrentPackage.ccstate */
+};
+
+#endif /* MLTON_GC_INTERNAL_TYPES */
+
 #if (defined (MLTON_GC_INTERNAL_BASIS))
 
+PRIVATE extern struct GC_writeBarrierInfo GC_writeBarrierInfo;
+
 #include "hierarchical-heap.h"
 
 PRIVATE void Assignable_writeBarrier(
@@ -31,6 +31,15 @@ static void HM_assertChunkListInvariants(HM_chunkList chunkList);
 size_t HM_BLOCK_SIZE;
 size_t HM_ALLOC_SIZE;
 
+/* don't bother coalescing until there are at least this many free chunks */
+#define HM_COALESCE_MIN_CHUNKS 64
+
+static inline uint32_t chunkClockMs(void) {
+  struct timespec now;
+  timespec_now(&now);
+  return (uint32_t)((uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000);
+}
+
 HM_chunk mmapNewChunk(size_t chunkWidth);
 HM_chunk mmapNewChunk(size_t chunkWidth) {
   assert(isAligned(chunkWidth, HM_BLOCK_SIZE));
@@ -39,6 +48,8 @@ HM_chunk mmapNewChunk(size_t chunkWidth) {
   if (MAP_FAILED == start) {
     return NULL;
   }
+  GC_state s = pthread_getspecific(gcstate_key);
+  __sync_fetch_and_add(&(HM_getSharedFreePool(s)->bytesMapped), chunkWidth);
   start = (pointer)(uintptr_t)align((uintptr_t)start, bs);
   HM_chunk result = HM_initializeChunk(start, start + chunkWidth);
 
@@ -55,6 +66,7 @@ void HM_configChunks(GC_state s) {
   assert(isAligned(s->controls->allocChunkSize, s->controls->blockSize));
   HM_BLOCK_SIZE = s->controls->blockSize;
   HM_ALLOC_SIZE = s->controls->allocChunkSize;
+  GC_writeBarrierInfo.blockMask = ~((uintptr_t)HM_BLOCK_SIZE - 1);
 
   HM_chunk firstChunk = mmapNewChunk(HM_BLOCK_SIZE * 16);
   HM_appendChunk(getFreeListExtraSmall(s), firstChunk);
@@ -100,13 +112,14 @@ HM_chunk HM_initializeChunk(pointer start, pointer end) {
   chunk->limit = end;
   chunk->nextChunk = NULL;
   chunk->prevChunk = NULL;
-  // chunk->nextAdjacent = NULL;
-  // chunk->prevAdjacent = NULL;
   chunk->levelHead = NULL;
   chunk->startGap = 0;
   chunk->mightContainMultipleObjects = TRUE;
+  chunk->decommitted = FALSE;
   chunk->tmpHeap = NULL;
+  chunk->liveBytes = 0;
   chunk->magic = CHUNK_MAGIC;
+  chunk->freedAt = 0;
 
 #if ASSERT
   /* clear out memory to quickly catch some memory safety errors */
@@ -116,23 +129,16 @@ HM_chunk HM_initializeChunk(pointer start, pointer end) {
   return chunk;
 }
 
-/* SAM_NOTE: Disabled for now because I disabled chunk coalescing, so the
- * function would be unused. But we could use this later if we re-enable
- * coalescing, perhaps with a different freelist architecture. */
-#if 0
 void HM_coalesceChunks(HM_chunk left, HM_chunk right) {
-  assert(left->nextAdjacent == right);
-  assert(right->prevAdjacent == left);
   assert(left->limit == (pointer)right);
+  assert(left->frontier == HM_getChunkStart(left));
 
   left->limit = right->limit;
-  left->nextAdjacent = right->nextAdjacent;
 
-  if (right->nextAdjacent != NULL) {
-    right->nextAdjacent->prevAdjacent = left;
-  }
+  /* the metadata of right is now free space within left; make sure nobody
+   * mistakes it for a chunk. */
+  right->magic = 0;
 }
-#endif
 
 static HM_chunk splitChunkAt(HM_chunkList list, HM_chunk chunk, pointer splitPoint) {
   assert(HM_getChunkStart(chunk) <= chunk->frontier);
@@ -146,6 +152,8 @@ static HM_chunk splitChunkAt(HM_chunkList list, HM_chunk chunk, pointer splitPoi
   chunk->limit = splitPoint;
   HM_chunk result = HM_initializeChunk(splitPoint, limit);
   result->levelHead = chunk->levelHead;
+  result->decommitted = chunk->decommitted;
+  result->freedAt = chunk->freedAt;
 
   if (NULL == chunk->nextChunk) {
     assert(list->lastChunk == chunk);
@@ -158,22 +166,9 @@ static HM_chunk splitChunkAt(HM_chunkList list, HM_chunk chunk, pointer splitPoi
   result->nextChunk = chunk->nextChunk;
   chunk->nextChunk = result;
 
-  // if (chunk->nextAdjacent != NULL) {
-    // chunk->nextAdjacent->prevAdjacent = result;
-  // }
-  // result->nextAdjacent = chunk->nextAdjacent;
-  // result->prevAdjacent = chunk;
-  // chunk->nextAdjacent = result;
-
   assert(chunk->nextChunk == result);
-  // assert(chunk->nextAdjacent == result);
   assert(result->prevChunk == chunk);
-  // assert(result->prevAdjacent == chunk);
   assert(chunk->limit == (pointer)result);
-  // if (result->nextAdjacent != NULL) {
-    // assert(result->limit == (pointer)result->nextAdjacent);
-    // assert(result->nextAdjacent->prevAdjacent == result);
-  // }
 
   return result;
 }
@@ -220,191 +215,500 @@ static inline bool chunkHasBytesFree(HM_chunk chunk, size_t bytes) {
   return chunk != NULL && (size_t)(chunk->limit - HM_getChunkStart(chunk)) >= bytes;
 }
 
-/* SAM_NOTE: Disabled this for now, as well as chunk coalescing (see in
- * HM_getFreeChunk below). In the past, HM_getLevelHead returned a chunklist,
- * but now we identify level heads with heap records, and there is no
- * associated heap for free lists. Of course, reusing chunk lists for freelists
- * is already a hack, so maybe it would be better to have an alternative
- * freelist representation. */
-/*
-static inline bool chunkIsInList(HM_chunk chunk, HM_chunkList list) {
-  assert(list != NULL);
-  return chunk != NULL &&
-         chunk->levelHead != NULL &&
-         HM_getLevelHead(chunk) == list;
+struct HM_sharedFreePool* HM_newSharedFreePool(void) {
+  struct HM_sharedFreePool* pool = malloc(sizeof(struct HM_sharedFreePool));
+  for (uint32_t i = 0; i < HM_NUM_SHARED_SIZE_CLASSES; i++) {
+    pool->shards[i] = NULL;
+  }
+  pool->size = 0;
+  pool->bytesMapped = 0;
+  pool->bytesDecommitted = 0;
+  pool->lastDecommitPass = 0;
+  return pool;
+}
+
+/* Decommitting a chunk releases every page except the first, which holds the
+ * chunk metadata. */
+static inline size_t decommittableBytes(HM_chunk chunk) {
+  pointer start = (pointer)(uintptr_t)align((uintptr_t)HM_getChunkStart(chunk), GC_pageSize());
+  return (start < chunk->limit) ? (size_t)(chunk->limit - start) : 0;
+}
+
+static inline void noteDecommitted(GC_state s, HM_chunk chunk) {
+  if (chunk->decommitted) {
+    __sync_fetch_and_add(&(HM_getSharedFreePool(s)->bytesDecommitted),
+                         decommittableBytes(chunk));
+  }
 }
-*/
-bool tryLockSharedList (GC_state s) {
-  return !(__sync_val_compare_and_swap(s->freeListLock, false, true));
+
+static inline void forgetDecommitted(GC_state s, HM_chunk chunk) {
+  if (chunk->decommitted) {
+    __sync_fetch_and_sub(&(HM_getSharedFreePool(s)->bytesDecommitted),
+                         decommittableBytes(chunk));
+  }
 }
 
-void unlockSharedList (GC_state s) {
-  assert(*(s->freeListLock));
-  *(s->freeListLock) = false;
+static void decommitChunk(GC_state s, HM_chunk chunk) {
+  assert(!chunk->decommitted);
+  assert(chunk->frontier == HM_getChunkStart(chunk));
+  size_t bytes = decommittableBytes(chunk);
+  if (0 == bytes) {
+    return;
+  }
 
+  GC_decommit(chunk->limit - bytes, bytes);
+  chunk->decommitted = TRUE;
+  noteDecommitted(s, chunk);
+  s->cumulativeStatistics->bytesDecommitted += bytes;
 }
 
-HM_chunk HM_checkSharedListForChunk(GC_state s, size_t bytesRequested) {
-  HM_chunkList sharedfreeList = HM_getsharedFreeList(s);
-  uint64_t bytesTotal = HM_getChunkListSize(sharedfreeList);
+/* floor(log2(number of blocks)), capped at numClasses-1 */
+static inline uint32_t chunkSizeClassOf(size_t chunkSize, uint32_t numClasses) {
+  size_t blocks = chunkSize / HM_BLOCK_SIZE;
+  assert(blocks >= 1);
+  uint32_t sizeClass = (uint32_t)(63 - __builtin_clzl((unsigned long)blocks));
+  return min(sizeClass, numClasses - 1);
+}
 
-// this might race but we can't sit around waiting for someone to populate the list
-  if (bytesTotal < bytesRequested)
-    return NULL;
+static inline uint32_t sharedSizeClassOf(size_t chunkSize) {
+  return chunkSizeClassOf(chunkSize, HM_NUM_SHARED_SIZE_CLASSES);
+}
 
-  struct HM_chunkList _tempList;
-  struct HM_chunkList _tempListLarge;
-  HM_chunkList tempList = &(_tempList);
-  HM_chunkList tempListLarge = &(_tempListLarge);
-  HM_initChunkList(tempList);
-  HM_initChunkList(tempListLarge);
-  bytesTotal/=(s->numberOfProcs);
-  uint64_t bytesVisited = 0;
-
-// for now I do not intend to have the proc waiting
-  if (!tryLockSharedList(s)) {
-    // printf("%s\n", "left for not waiting");
-    return NULL;
+void HM_initFreeChunkIndex(struct HM_freeChunkIndex* index) {
+  for (uint32_t i = 0; i < HM_NUM_FREE_BINS; i++) {
+    HM_initChunkList(&(index->bins[i]));
   }
+  index->nonEmptyBins = 0;
+  index->numChunks = 0;
+  index->numChunksAfterCoalesce = 0;
+  index->lastDecommitPass = 0;
+}
 
+static inline uint32_t freeBinOf(HM_chunk chunk) {
+  return chunkSizeClassOf(HM_getChunkSize(chunk), HM_NUM_FREE_BINS);
+}
 
-  HM_chunk chunk = HM_getChunkListFirstChunk(sharedfreeList);
-  HM_chunk foundChunk = NULL;
-  bool foundChunkB = false;
-  bool traverseList = HM_getChunkListFirstChunk(getFreeListSmall(s)) == NULL;
-  int count = 3;
-  uint64_t largListThresh = s->nextChunkAllocSize;
+/* Reset a free chunk and put it in its bin. Recently freed chunks go at the
+ * front, since they are the most likely to still be in cache. */
+static void insertFreeChunk(struct HM_freeChunkIndex* index, HM_chunk chunk) {
+  assert(chunk->nextChunk == NULL && chunk->prevChunk == NULL);
+  chunk->startGap = 0;
+  chunk->frontier = HM_getChunkStart(chunk);
+  chunk->levelHead = NULL;
+  chunk->tmpHeap = NULL;
 
-  while((traverseList || !foundChunkB) && chunk!=NULL) {
-    // HM_unlinkChunk(sharedfreeList, chunk);
-    // HM_appendChunk(tempList, chunk);
-    bytesVisited+=HM_getChunkSize(chunk);
+  uint32_t bin = freeBinOf(chunk);
+  HM_prependChunk(&(index->bins[bin]), chunk);
+  index->nonEmptyBins |= ((uint32_t)1 << bin);
+  index->numChunks++;
+}
 
-    if(!foundChunkB && chunkHasBytesFree(chunk, bytesRequested)) {
-      HM_unlinkChunk(sharedfreeList, chunk);
-      HM_appendChunk(tempList, chunk);
-      foundChunk = chunk;
-      foundChunkB = true;
-      chunk = HM_getChunkListFirstChunk(sharedfreeList);
-      bytesTotal = min(bytesTotal, HM_getChunkSize(foundChunk)*4);
-    }
-    else if (traverseList) {
-      HM_unlinkChunk(sharedfreeList, chunk);
-      if (HM_getChunkSize(chunk) >= largListThresh) {
-        HM_prependChunk(tempListLarge, chunk);
-      }
-      else {
-        HM_prependChunk(tempList, chunk);
-      }
-      chunk = HM_getChunkListFirstChunk(sharedfreeList);
-      count --;
-      traverseList = (count>0);
-    }
-    else {
-      chunk = chunk->nextChunk;
-    }
+static void unlinkFreeChunk(struct HM_freeChunkIndex* index, HM_chunk chunk) {
+  uint32_t bin = freeBinOf(chunk);
+  HM_unlinkChunk(&(index->bins[bin]), chunk);
+  if (NULL == index->bins[bin].firstChunk) {
+    index->nonEmptyBins &= ~((uint32_t)1 << bin);
   }
-  unlockSharedList(s);
-  HM_appendChunkList(getFreeListSmall(s), tempList);
-  for (HM_chunk chunk = tempListLarge->firstChunk; chunk!=NULL; chunk = chunk->nextChunk) {
-    chunk->frontier = HM_getChunkStart(chunk);
+  index->numChunks--;
+}
+
+/* Chunks appended to freeListSmall (by collections, for example) are binned
+ * lazily, here. Each chunk is binned once, so this is amortized O(1) per
+ * freed chunk. */
+static void binPendingFreeChunks(GC_state s) {
+  HM_chunkList pending = getFreeListSmall(s);
+  if (NULL == pending->firstChunk) {
+    return;
+  }
+
+  uint32_t now = chunkClockMs();
+  HM_chunk chunk = pending->firstChunk;
+  while (chunk != NULL) {
+    HM_chunk next = chunk->nextChunk;
+    HM_unlinkChunk(pending, chunk);
+    chunk->freedAt = now;
+    insertFreeChunk(getFreeChunkIndex(s), chunk);
+    chunk = next;
   }
-  HM_appendChunkList(getFreeListLarge(s), tempListLarge);
-  return foundChunk;
 }
 
-HM_chunk HM_getFreeChunk(GC_state s, size_t bytesRequested) {
-  HM_chunk chunk = getFreeListSmall(s)->firstChunk;
-
-  // can increase this number to cycle through more chunks
-  int remainingToCheck = 2;
-  while (chunk != NULL && remainingToCheck > 0) {
-    /* SAM_NOTE: Disabled for now, because chunkIsInList check has been
-     * deprecated.
-     *
-     * Coalescing wasn't getting much benefit anyway. Later, if we really need
-     * coalescing, a better approach would be to incrementally sort the freelist
-     * and look for physically adjacent chunks. The pointers {next,prev}Adjacent
-     * would still be necessary for this! So I'm leaving them in. */
-#if 0
-    if (s->controls->freeListCoalesce) {
-      HM_unlinkChunk(chunk);
-      if (chunkIsInList(chunk->prevAdjacent, s->freeListSmall)) {
-        assert(chunk->prevAdjacent->nextAdjacent == chunk);
-        HM_unlinkChunk(chunk->prevAdjacent);
-        chunk = chunk->prevAdjacent;
-        HM_coalesceChunks(chunk, chunk->nextAdjacent);
-      }
-      if (chunkIsInList(chunk->nextAdjacent, s->freeListSmall)) {
-        HM_unlinkChunk(chunk->nextAdjacent);
-        HM_coalesceChunks(chunk, chunk->nextAdjacent);
+/* Find a free chunk with at least bytesRequested free bytes, without
+ * unlinking it. Bin i holds chunks of [2^i, 2^(i+1)) blocks, so every chunk
+ * in a bin above the bin of the request is large enough. We only look at the
+ * front of the request's own bin, which keeps the search O(1) except for
+ * requests that fall in the last (unbounded) bin. */
+static HM_chunk findFreeChunk(struct HM_freeChunkIndex* index, size_t bytesRequested) {
+  size_t bytesNeeded = align(bytesRequested + sizeof(struct HM_chunk), HM_BLOCK_SIZE);
+  uint32_t bin = chunkSizeClassOf(bytesNeeded, HM_NUM_FREE_BINS);
+
+  HM_chunk chunk = index->bins[bin].firstChunk;
+  if (chunkHasBytesFree(chunk, bytesRequested)) {
+    return chunk;
+  }
+
+  uint64_t largerBins =
+    (uint64_t)index->nonEmptyBins & ~(((uint64_t)2 << bin) - 1);
+  if (largerBins != 0) {
+    chunk = index->bins[__builtin_ctzll(largerBins)].firstChunk;
+    assert(chunkHasBytesFree(chunk, bytesRequested));
+    return chunk;
+  }
+
+  if (bin == HM_NUM_FREE_BINS - 1) {
+    for (chunk = index->bins[bin].firstChunk; chunk != NULL; chunk = chunk->nextChunk) {
+      if (chunkHasBytesFree(chunk, bytesRequested)) {
+        return chunk;
       }
-      HM_prependChunk(s->freeListSmall, chunk);
     }
-#endif
-    // chunks in freeListSmall might have frontiers/gaps that haven't been reset
-    chunk->startGap = 0;
-    chunk->frontier = HM_getChunkStart(chunk);
+  }
+
+  return NULL;
+}
+
+/* Split off the front of a free (unlinked) chunk, just large enough for the
+ * request, and put the remainder back in the index. */
+static HM_chunk carveFreeChunk(
+  GC_state s,
+  HM_chunk chunk,
+  size_t bytesRequested)
+{
+  assert(chunk->frontier == HM_getChunkStart(chunk));
+  assert(chunkHasBytesFree(chunk, bytesRequested));
+  forgetDecommitted(s, chunk);
+
+  struct HM_chunkList _list;
+  HM_chunkList list = &(_list);
+  HM_initChunkList(list);
+  HM_appendChunk(list, chunk);
+
+  HM_chunk remainder = splitChunkFront(list, chunk, bytesRequested);
+  HM_unlinkChunk(list, chunk);
+  if (remainder != NULL) {
+    HM_unlinkChunk(list, remainder);
+    noteDecommitted(s, remainder);
+    insertFreeChunk(getFreeChunkIndex(s), remainder);
+  }
+
+  chunk->mightContainMultipleObjects = TRUE;
+  chunk->decommitted = FALSE;
+  chunk->tmpHeap = NULL;
+  return chunk;
+}
 
-    /* if this chunk is good, then we're done. */
-    if (chunkHasBytesFree(chunk, bytesRequested)) {
-      assert(chunk->frontier == HM_getChunkStart(chunk));
-      chunk->mightContainMultipleObjects = TRUE;
-      chunk->tmpHeap = NULL;
-      splitChunkFront(getFreeListSmall(s), chunk, bytesRequested);
-      HM_unlinkChunk(getFreeListSmall(s), chunk);
-      return chunk;
+/* Merge sort a list of chunks (linked only through nextChunk) by address. */
+static HM_chunk sortChunksByAddress(HM_chunk list, size_t length) {
+  if (length <= 1) {
+    return list;
+  }
+
+  size_t leftLength = length / 2;
+  HM_chunk leftLast = list;
+  for (size_t i = 1; i < leftLength; i++) {
+    leftLast = leftLast->nextChunk;
+  }
+  HM_chunk right = leftLast->nextChunk;
+  leftLast->nextChunk = NULL;
+
+  HM_chunk left = sortChunksByAddress(list, leftLength);
+  right = sortChunksByAddress(right, length - leftLength);
+
+  struct HM_chunk head;
+  HM_chunk last = &head;
+  while (left != NULL && right != NULL) {
+    if ((uintptr_t)left < (uintptr_t)right) {
+      last->nextChunk = left;
+      left = left->nextChunk;
+    } else {
+      last->nextChunk = right;
+      right = right->nextChunk;
     }
+    last = last->nextChunk;
+  }
+  last->nextChunk = (left != NULL) ? left : right;
+
+  return head.nextChunk;
+}
 
-    /* otherwise, rotate this chunk onto the end and keep searching. */
-    HM_unlinkChunk(getFreeListSmall(s), chunk);
-    HM_appendChunk(getFreeListSmall(s), chunk);
-    remainingToCheck--;
-    chunk = getFreeListSmall(s)->firstChunk;
+void HM_coalesceFreeChunks(GC_state s) {
+  if (!s->controls->freeListCoalesce) {
+    return;
   }
 
-  chunk = getFreeListLarge(s)->firstChunk;
-  /* chunks in freeListLarge should always have properly set frontiers */
-  assert(chunk == NULL || chunk->frontier == HM_getChunkStart(chunk));
+  struct HM_freeChunkIndex* index = getFreeChunkIndex(s);
+  binPendingFreeChunks(s);
 
-  /* if this chunk is good, we're done. */
-  if (chunkHasBytesFree(chunk, bytesRequested)) {
-    chunk->mightContainMultipleObjects = TRUE;
-    chunk->tmpHeap = NULL;
-    splitChunkFront(getFreeListLarge(s), chunk, bytesRequested);
-    HM_unlinkChunk(getFreeListLarge(s), chunk);
-    return chunk;
+  /* Only coalesce once the number of free chunks has doubled since the last
+   * pass, so that the cost of sorting is amortized over the chunks that were
+   * freed in between. */
+  if (index->numChunks < HM_COALESCE_MIN_CHUNKS ||
+      index->numChunks < 2 * index->numChunksAfterCoalesce)
+  {
+    return;
   }
 
-  /* otherwise, dump it into the freelist of small chunks and mmap a fresh
-   * large chunk. */
+  size_t numChunksBefore = index->numChunks;
+  HM_chunk all = NULL;
+  for (uint32_t i = 0; i < HM_NUM_FREE_BINS; i++) {
+    HM_chunk chunk = index->bins[i].firstChunk;
+    while (chunk != NULL) {
+      HM_chunk next = chunk->nextChunk;
+      chunk->nextChunk = all;
+      all = chunk;
+      chunk = next;
+    }
+  }
+  HM_initFreeChunkIndex(index);
+
+  all = sortChunksByAddress(all, numChunksBefore);
+
+  size_t bytesCoalesced = 0;
+  HM_chunk chunk = all;
+  while (chunk != NULL) {
+    HM_chunk next = chunk->nextChunk;
+    while (next != NULL && chunk->limit == (pointer)next) {
+      HM_chunk afterNext = next->nextChunk;
+      bytesCoalesced += HM_getChunkSize(next);
+      forgetDecommitted(s, chunk);
+      forgetDecommitted(s, next);
+      bool decommitted = chunk->decommitted && next->decommitted;
+      chunk->freedAt = max(chunk->freedAt, next->freedAt);
+      HM_coalesceChunks(chunk, next);
+      chunk->decommitted = decommitted;
+      noteDecommitted(s, chunk);
+      next = afterNext;
+    }
+    chunk->nextChunk = NULL;
+    chunk->prevChunk = NULL;
+    insertFreeChunk(index, chunk);
+    chunk = next;
+  }
 
-  if (chunk != NULL) {
-    HM_unlinkChunk(getFreeListLarge(s), chunk);
-    HM_appendChunk(getFreeListSmall(s), chunk);
+  index->numChunksAfterCoalesce = index->numChunks;
+  s->cumulativeStatistics->numChunksCoalesced += numChunksBefore - index->numChunks;
+  s->cumulativeStatistics->bytesCoalesced += bytesCoalesced;
+
+  LOG(LM_CHUNK, LL_INFO,
+      "Coalesced %zu free chunks into %zu (%zu bytes recovered)",
+      numChunksBefore,
+      index->numChunks,
+      bytesCoalesced);
+}
+
+static inline struct HM_chunkBatch* batchOf(HM_chunk chunk) {
+  return (struct HM_chunkBatch*)((pointer)chunk + sizeof(struct HM_chunk));
+}
+
+static void pushSharedBatch(
+  struct HM_sharedFreePool* pool,
+  uint32_t sizeClass,
+  HM_chunkList list)
+{
+  assert(list->firstChunk != NULL);
+  struct HM_chunkBatch* batch = batchOf(list->firstChunk);
+  batch->chunks = *list;
+  __sync_fetch_and_add(&(pool->size), list->size);
+
+  struct HM_chunkBatch* head;
+  do {
+    head = pool->shards[sizeClass];
+    batch->nextBatch = head;
+  } while (!__sync_bool_compare_and_swap(&(pool->shards[sizeClass]), head, batch));
+
+  HM_initChunkList(list);
+}
+
+/* Take every batch in the size class, and flatten them into one list. */
+static void popSharedBatches(
+  struct HM_sharedFreePool* pool,
+  uint32_t sizeClass,
+  HM_chunkList result)
+{
+  struct HM_chunkBatch* batch =
+    __sync_lock_test_and_set(&(pool->shards[sizeClass]), NULL);
+
+  while (batch != NULL) {
+    /* copy the descriptor out before touching the chunk, since the
+     * descriptor lives inside of it. */
+    struct HM_chunkBatch* next = batch->nextBatch;
+    struct HM_chunkList chunks = batch->chunks;
+    HM_appendChunkList(result, &chunks);
+    batch = next;
   }
 
-  chunk = HM_checkSharedListForChunk(s, bytesRequested);
+  __sync_fetch_and_sub(&(pool->size), result->size);
+}
+
+void HM_appendToSharedList(GC_state s, HM_chunkList list) {
+  struct HM_chunkList classLists[HM_NUM_SHARED_SIZE_CLASSES];
+  for (uint32_t i = 0; i < HM_NUM_SHARED_SIZE_CLASSES; i++) {
+    HM_initChunkList(&(classLists[i]));
+  }
+
+  uint32_t now = chunkClockMs();
 
-  if(chunk!=NULL) {
+  HM_chunk chunk = list->firstChunk;
+  while (chunk != NULL) {
+    HM_chunk next = chunk->nextChunk;
+    HM_unlinkChunk(list, chunk);
     chunk->startGap = 0;
     chunk->frontier = HM_getChunkStart(chunk);
-    chunk->mightContainMultipleObjects = TRUE;
     chunk->tmpHeap = NULL;
-    assert(chunkHasBytesFree(chunk, bytesRequested));
+    chunk->freedAt = now;
+    HM_appendChunk(&(classLists[sharedSizeClassOf(HM_getChunkSize(chunk))]), chunk);
+    chunk = next;
+  }
+
+  for (uint32_t i = 0; i < HM_NUM_SHARED_SIZE_CLASSES; i++) {
+    if (classLists[i].firstChunk != NULL) {
+      pushSharedBatch(HM_getSharedFreePool(s), i, &(classLists[i]));
+    }
+  }
+}
+
+HM_chunk HM_checkSharedListForChunk(GC_state s, size_t bytesRequested) {
+  struct HM_sharedFreePool* pool = HM_getSharedFreePool(s);
+  size_t bytesNeeded = align(bytesRequested + sizeof(struct HM_chunk), HM_BLOCK_SIZE);
+
+  /* If another processor is in the middle of taking from a size class, that
+   * class appears empty. The pool size tells us whether it is worth looking
+   * a second time before giving up and mmap-ing. */
+  for (int attempt = 0; attempt < 2 && pool->size >= bytesNeeded; attempt++) {
+    for (uint32_t sizeClass = sharedSizeClassOf(bytesNeeded);
+         sizeClass < HM_NUM_SHARED_SIZE_CLASSES;
+         sizeClass++)
+    {
+      if (NULL == pool->shards[sizeClass]) {
+        continue;
+      }
 
-    HM_chunkList lis = getFreeListSmall(s);
+      struct HM_chunkList _taken;
+      HM_chunkList taken = &(_taken);
+      HM_initChunkList(taken);
+      popSharedBatches(pool, sizeClass, taken);
+
+      HM_chunk foundChunk = NULL;
+      for (HM_chunk chunk = taken->firstChunk; chunk != NULL; chunk = chunk->nextChunk) {
+        if (chunkHasBytesFree(chunk, bytesRequested)) {
+          foundChunk = chunk;
+          break;
+        }
+      }
+
+      if (NULL == foundChunk) {
+        if (taken->firstChunk != NULL) {
+          pushSharedBatch(pool, sizeClass, taken);
+        }
+        continue;
+      }
 
-    if(HM_getChunkSize(chunk) > s->nextChunkAllocSize ) {
-      HM_unlinkChunk(getFreeListSmall(s), chunk);
-      HM_prependChunk(getFreeListLarge(s), chunk);
-      lis = getFreeListLarge(s);
+      HM_unlinkChunk(taken, foundChunk);
+
+      /* Keep roughly this processor's share of what we took, and give the
+       * rest back to the pool. */
+      size_t bytesToKeep = taken->size / s->numberOfProcs;
+      size_t bytesKept = 0;
+      while (taken->firstChunk != NULL && bytesKept < bytesToKeep) {
+        HM_chunk chunk = taken->firstChunk;
+        HM_unlinkChunk(taken, chunk);
+        bytesKept += HM_getChunkSize(chunk);
+        insertFreeChunk(getFreeChunkIndex(s), chunk);
+      }
+
+      if (taken->firstChunk != NULL) {
+        pushSharedBatch(pool, sizeClass, taken);
+      }
+
+      return foundChunk;
     }
-    splitChunkFront(lis, chunk, bytesRequested);
-    HM_unlinkChunk(lis, chunk);
-    return chunk;
   }
 
+  return NULL;
+}
+
+static inline bool overMaxRSS(GC_state s) {
+  struct HM_sharedFreePool* pool = HM_getSharedFreePool(s);
+  size_t maxRSS = s->controls->maxRSS;
+  size_t mapped = pool->bytesMapped;
+  size_t decommitted = pool->bytesDecommitted;
+  return maxRSS != 0 && mapped > decommitted && mapped - decommitted > maxRSS;
+}
+
+static inline bool shouldDecommit(GC_state s, HM_chunk chunk, uint32_t now, bool force) {
+  return !chunk->decommitted
+      && (force || (uint32_t)(now - chunk->freedAt) >= s->controls->decommitIdleTime);
+}
+
+/* Decommit chunks of the list, largest bins first. Returns whether the heap
+ * is still over the RSS cap. */
+static bool decommitChunksInList(GC_state s, HM_chunkList list, uint32_t now, bool force) {
+  for (HM_chunk chunk = list->firstChunk; chunk != NULL; chunk = chunk->nextChunk) {
+    if (shouldDecommit(s, chunk, now, force)) {
+      decommitChunk(s, chunk);
+      if (force && !overMaxRSS(s)) {
+        return FALSE;
+      }
+    }
+  }
+  return force;
+}
+
+void HM_decommitFreeChunks(GC_state s) {
+  struct HM_freeChunkIndex* index = getFreeChunkIndex(s);
+  struct HM_sharedFreePool* pool = HM_getSharedFreePool(s);
+  uint32_t idleTime = s->controls->decommitIdleTime;
+  bool force = overMaxRSS(s);
+
+  if (!force && 0 == idleTime) {
+    return;
+  }
+
+  /* Without memory pressure, a pass every half of the idle time is enough
+   * for chunks to be decommitted within 1.5x of the idle time. */
+  uint32_t now = chunkClockMs();
+  if (!force && (uint32_t)(now - index->lastDecommitPass) < idleTime / 2) {
+    return;
+  }
+  index->lastDecommitPass = now;
+
+  binPendingFreeChunks(s);
+  for (int32_t bin = HM_NUM_FREE_BINS - 1; bin >= 0; bin--) {
+    force = decommitChunksInList(s, &(index->bins[bin]), now, force);
+  }
+
+  /* One processor at a time also sweeps the shared pool. */
+  uint32_t last = pool->lastDecommitPass;
+  if ((force || (uint32_t)(now - last) >= idleTime / 2) &&
+      __sync_bool_compare_and_swap(&(pool->lastDecommitPass), last, now))
+  {
+    for (int32_t sizeClass = HM_NUM_SHARED_SIZE_CLASSES - 1; sizeClass >= 0; sizeClass--) {
+      struct HM_chunkList _taken;
+      HM_chunkList taken = &(_taken);
+      HM_initChunkList(taken);
+      popSharedBatches(pool, (uint32_t)sizeClass, taken);
+      if (NULL == taken->firstChunk) {
+        continue;
+      }
+      force = decommitChunksInList(s, taken, now, force);
+      pushSharedBatch(pool, (uint32_t)sizeClass, taken);
+    }
+  }
+}
+
+HM_chunk HM_getFreeChunk(GC_state s, size_t bytesRequested) {
+  struct HM_freeChunkIndex* index = getFreeChunkIndex(s);
+  binPendingFreeChunks(s);
+
+  HM_chunk chunk = findFreeChunk(index, bytesRequested);
+  if (chunk != NULL) {
+    unlinkFreeChunk(index, chunk);
+    return carveFreeChunk(s, chunk, bytesRequested);
+  }
+
+  chunk = HM_checkSharedListForChunk(s, bytesRequested);
+  if (chunk != NULL) {
+    assert(chunk->frontier == HM_getChunkStart(chunk));
+    return carveFreeChunk(s, chunk, bytesRequested);
+  }
 
   size_t bytesNeeded = align(bytesRequested + sizeof(struct HM_chunk), HM_BLOCK_SIZE);
   size_t allocSize = max(bytesNeeded, s->nextChunkAllocSize);
@@ -434,19 +738,64 @@ HM_chunk HM_getFreeChunk(GC_state s, size_t bytesRequested) {
     }
   }
 
-  HM_prependChunk(getFreeListLarge(s), chunk);
+  /* freshly mapped memory is not resident until it is touched */
+  chunk->decommitted = TRUE;
+  noteDecommitted(s, chunk);
+
   assert(chunk->frontier == HM_getChunkStart(chunk));
-  assert(chunkHasBytesFree(chunk, bytesRequested));
-  chunk->mightContainMultipleObjects = TRUE;
-  chunk->tmpHeap = NULL;
-  splitChunkFront(getFreeListLarge(s), chunk, bytesRequested);
-  HM_unlinkChunk(getFreeListLarge(s), chunk);
-  return chunk;
+  return carveFreeChunk(s, chunk, bytesRequested);
+}
+
+/* Put a batch of HM_ALLOC_SIZE chunks in the processor's reserve. Chunks
+ * freed by recent collections on this processor are used first; whatever is
+ * missing is taken in one piece from the shared pool or a fresh mapping and
+ * cut up here. */
+static void refillAllocReserve(GC_state s) {
+  HM_chunkList reserve = getAllocReserve(s);
+  struct HM_freeChunkIndex* index = getFreeChunkIndex(s);
+  size_t bytesPerChunk = HM_ALLOC_SIZE - sizeof(struct HM_chunk);
+  assert(NULL == reserve->firstChunk);
+
+  binPendingFreeChunks(s);
+  size_t numChunks = 0;
+  while (numChunks < HM_ALLOC_RESERVE_BATCH) {
+    HM_chunk chunk = findFreeChunk(index, bytesPerChunk);
+    if (NULL == chunk) {
+      break;
+    }
+    unlinkFreeChunk(index, chunk);
+    HM_appendChunk(reserve, carveFreeChunk(s, chunk, bytesPerChunk));
+    numChunks++;
+  }
+
+  if (numChunks < HM_ALLOC_RESERVE_BATCH) {
+    size_t bytesMissing =
+      (HM_ALLOC_RESERVE_BATCH - numChunks) * HM_ALLOC_SIZE - sizeof(struct HM_chunk);
+    HM_chunk chunk = HM_getFreeChunk(s, bytesMissing);
+    HM_appendChunk(reserve, chunk);
+    while (NULL != chunk) {
+      chunk = splitChunkFront(reserve, chunk, bytesPerChunk);
+    }
+  }
+
+  s->cumulativeStatistics->numAllocReserveRefills++;
 }
 
 HM_chunk HM_allocateChunk(HM_chunkList list, size_t bytesRequested) {
   GC_state s = pthread_getspecific(gcstate_key);
-  HM_chunk chunk = HM_getFreeChunk(s, bytesRequested);
+  HM_chunk chunk;
+
+  if (bytesRequested <= HM_ALLOC_SIZE - sizeof(struct HM_chunk)) {
+    HM_chunkList reserve = getAllocReserve(s);
+    if (NULL == reserve->firstChunk) {
+      refillAllocReserve(s);
+    }
+    chunk = reserve->firstChunk;
+    HM_unlinkChunk(reserve, chunk);
+    chunk->levelHead = NULL;
+  } else {
+    chunk = HM_getFreeChunk(s, bytesRequested);
+  }
 
   if (NULL == chunk) {
     DIE("Out of memory. Unable to allocate chunk of size %zu.",
@@ -672,23 +1021,15 @@ HM_HierarchicalHeap HM_getLevelHeadPathCompress(HM_chunk chunk) {
 }
 
 void HM_deleteChunks(GC_state s, HM_chunkList deleteList) {
-  while(!tryLockSharedList(s)) {}
-  assert(*(s->freeListLock));
   HM_chunk chunk = deleteList->firstChunk;
   while (chunk!=NULL) {
     HM_chunk c = chunk;
     chunk = chunk->nextChunk;
     HM_unlinkChunk(deleteList, c);
+    forgetDecommitted(s, c);
+    __sync_fetch_and_sub(&(HM_getSharedFreePool(s)->bytesMapped), HM_getChunkSize(c));
     GC_release (c, HM_getChunkSize(c));
   }
-  unlockSharedList(s);
-}
-
-void HM_appendToSharedList(GC_state s, HM_chunkList list) {
-  while (!tryLockSharedList(s)) {}
-  assert(*(s->freeListLock));
-  HM_appendChunkList(s->sharedfreeList, list);
-  unlockSharedList(s);
 }
 
 void HM_appendChunkList(HM_chunkList list1, HM_chunkList list2) {
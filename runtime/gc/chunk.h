@@ -51,9 +51,6 @@ struct HM_chunk {
   HM_chunk nextChunk;
   HM_chunk prevChunk;
 
-  // HM_chunk nextAdjacent;
-  // HM_chunk prevAdjacent;
-
   /* some chunks may be used to store other non-ML allocated objects, like
    * heap records; if so, these will be stored at the front of the chunk, and
    * the startGap will indicate the amount of space used.
@@ -63,10 +60,19 @@ struct HM_chunk {
   uint8_t startGap;
 
   bool mightContainMultipleObjects;
+
+  /* free chunks only: whether the pages past the first have been returned
+   * to the OS, and when (in ms, wrapping) the chunk was freed. */
+  bool decommitted;
+
   void* tmpHeap;
 
+  /* during a concurrent collection: bytes of marked objects in this chunk */
+  size_t liveBytes;
+
   // for padding and sanity checks
   uint32_t magic;
+  uint32_t freedAt;
 
 } __attribute__((aligned(8)));
 
@@ -77,6 +83,48 @@ struct HM_chunkList {
   size_t size; // size (bytes) of this level, both allocated and unallocated
 } __attribute__((aligned(8)));
 
+/* Each processor indexes its free chunks by size. Bin i holds chunks of
+ * [2^i, 2^(i+1)) blocks, and bit i of nonEmptyBins is set iff bin i is
+ * nonempty, so that finding a large enough chunk is O(1). */
+#define HM_NUM_FREE_BINS 32
+
+struct HM_freeChunkIndex {
+  struct HM_chunkList bins[HM_NUM_FREE_BINS];
+  uint32_t nonEmptyBins;
+  size_t numChunks;
+  size_t numChunksAfterCoalesce;
+  uint32_t lastDecommitPass; // ms, wrapping
+};
+
+/* The shared free pool is split into size classes. Class i holds chunks of
+ * at least 2^i blocks (and fewer than 2^(i+1), except for the last class). */
+#define HM_NUM_SHARED_SIZE_CLASSES 16
+
+/* A batch of free chunks which all belong to the same size class. The batch
+ * descriptor is stored in the free space of the first chunk of the batch, so
+ * pushing a batch onto the shared pool requires no extra allocation. */
+struct HM_chunkBatch {
+  struct HM_chunkBatch* nextBatch;
+  struct HM_chunkList chunks;
+};
+
+/* Free chunks shared between all processors. Each size class is a lock-free
+ * stack of batches. Pushes CAS a batch onto the front; pops swap out the
+ * whole stack, take what they need, and push the remainder back. Swapping
+ * out the whole stack avoids both ABA and reading the descriptor of a batch
+ * that another processor has already reused. */
+struct HM_sharedFreePool {
+  struct HM_chunkBatch* shards[HM_NUM_SHARED_SIZE_CLASSES];
+  size_t size; // approximate total bytes in the pool
+
+  /* Global accounting of chunk memory, maintained atomically. The difference
+   * is an estimate of the resident size of the heap. */
+  size_t bytesMapped;
+  size_t bytesDecommitted;
+
+  uint32_t lastDecommitPass; // ms, wrapping
+};
+
 COMPILE_TIME_ASSERT(HM_chunk__aligned,
                     (sizeof(struct HM_chunk) % 8) == 0);
 
@@ -126,8 +174,17 @@ void HM_configChunks(GC_state s);
 
 HM_chunk HM_initializeChunk(pointer start, pointer end);
 
+/* Returns a chunk with at least bytesRequested free bytes, not in any list.
+ * Looks in the local free chunk index, then the shared pool, and otherwise
+ * maps new memory. */
 HM_chunk HM_getFreeChunk(GC_state s, size_t bytesRequested);
 
+void HM_initFreeChunkIndex(struct HM_freeChunkIndex* index);
+
+/* Chunks of at most HM_ALLOC_SIZE are handed out from a per-processor
+ * reserve, which is refilled this many chunks at a time. */
+#define HM_ALLOC_RESERVE_BATCH 8
+
 /* Allocate and return a pointer to a new chunk in the list
  * Requires
  *   chunk->limit - chunk->frontier <= bytesRequested
@@ -138,7 +195,18 @@ void HM_initChunkList(HM_chunkList list);
 HM_chunkList HM_newChunkList(void);
 
 void HM_deleteChunks(GC_state s, HM_chunkList deleteList);
+
+/* Move all chunks of the list into the shared free pool, where they can be
+ * reused by any processor. The list is empty afterwards. */
 void HM_appendToSharedList(GC_state s, HM_chunkList list);
+
+/* Look in the shared free pool for a chunk with at least bytesRequested free
+ * bytes. The returned chunk is not in any list; other chunks taken from the
+ * pool are moved into the local free lists of s. Returns NULL if no such
+ * chunk was found. */
+HM_chunk HM_checkSharedListForChunk(GC_state s, size_t bytesRequested);
+
+struct HM_sharedFreePool* HM_newSharedFreePool(void);
 void HM_appendChunkList(HM_chunkList destinationChunkList, HM_chunkList chunkList);
 
 void HM_appendChunk(HM_chunkList list, HM_chunk chunk);
@@ -156,8 +224,23 @@ void HM_unlinkChunk(HM_chunkList list, HM_chunk chunk);
  * if chunk cannot be split as such, returns NULL. */
 HM_chunk HM_splitChunk(HM_chunkList list, HM_chunk chunk, size_t bytesRequested);
 
+/* Requires: left and right are free, and physically adjacent
+ *   (left->limit == right)
+ * Merges right into left. */
 void HM_coalesceChunks(HM_chunk left, HM_chunk right);
 
+/* Merge physically adjacent chunks in the local free chunk index, if
+ * freeListCoalesce is enabled. Meant to be called at the end of a
+ * collection; it only does work once enough chunks have been freed since
+ * the last pass. */
+void HM_coalesceFreeChunks(GC_state s);
+
+/* Return the pages of idle free chunks to the OS. A chunk is idle once it
+ * has been free for the decommitIdleTime control. If the heap is larger
+ * than the maxRSS control, free chunks are decommitted regardless of how
+ * long they have been idle. Meant to be called at the end of a collection. */
+void HM_decommitFreeChunks(GC_state s);
+
 struct HM_HierarchicalHeap* HM_getLevelHeadPathCompress(HM_chunk chunk);
 
 /* Lookup the levelhead for this chunk, but don't path compress. This is useful
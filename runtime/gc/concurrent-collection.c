@@ -13,8 +13,12 @@
 
 void forwardPtrChunk (GC_state s, objptr *opp, void* rawArgs);
 void saveChunk(HM_chunk chunk, ConcurrentCollectArgs* args);
+static void shareFieldsOf(GC_state s, pointer p, ConcurrentCollectArgs* args);
 #define ASSERT2 0
 
+/* a kept chunk is "sparse" if less than this percent of it is live */
+#define CC_SPARSE_CHUNK_PERCENT 25
+
 void CC_initStack(ConcurrentPackage cp) {
   CC_stack* temp  = (struct CC_stack*) malloc(sizeof(struct CC_stack));
   CC_stack_init(temp, 2);
@@ -41,6 +45,218 @@ bool CC_isPointerMarked (pointer p) {
   return ((MARK_MASK & getHeader (p)) == MARK_MASK);
 }
 
+/* ========================================================================= */
+/* Parallel marking
+ *
+ * Tracing is done with explicit mark stacks rather than recursion. During a
+ * root collection the collector opens a shared pool of marking work; idle
+ * workers join through CC_helpCollectAtRoot, and workers move batches of
+ * objects between their own stack and the pool. Mark bits are flipped with a
+ * CAS so that each object is scanned by exactly one worker. Only one root
+ * collection runs at a time, so there is a single pool. */
+
+#define CC_MARK_STACK_MIN_CAPACITY 1024
+/* objects moved between a worker's stack and the pool at a time */
+#define CC_MARK_SHARE_BATCH 128
+/* empty polls after which a helper goes back to looking for user work */
+#define CC_HELPER_PATIENCE 4096
+
+static struct CC_markPool {
+  spinlock_t lock;
+  volatile bool open;
+  // the collector's args; helpers copy them and substitute their own stack
+  ConcurrentCollectArgs* args;
+  CC_markStack work;
+  // workers currently holding marking work, including the collector
+  uint32_t busy;
+  // helpers currently inside CC_helpCollectAtRoot
+  volatile uint32_t helpers;
+  // guards the chunk lists of the collection
+  spinlock_t listLock;
+} CC_markPool = {
+  .lock = SPINLOCK_INITIALIZER,
+  .open = FALSE,
+  .args = NULL,
+  .work = {.items = NULL, .size = 0, .capacity = 0},
+  .busy = 0,
+  .helpers = 0,
+  .listLock = SPINLOCK_INITIALIZER
+};
+
+static void markStackInit(CC_markStack* stack) {
+  stack->items = NULL;
+  stack->size = 0;
+  stack->capacity = 0;
+}
+
+static void markStackFree(CC_markStack* stack) {
+  free(stack->items);
+  markStackInit(stack);
+}
+
+static void markStackReserve(CC_markStack* stack, size_t extra) {
+  if (stack->size + extra <= stack->capacity)
+    return;
+
+  size_t capacity = (stack->capacity < CC_MARK_STACK_MIN_CAPACITY)
+                    ? CC_MARK_STACK_MIN_CAPACITY
+                    : stack->capacity;
+  while (capacity < stack->size + extra)
+    capacity *= 2;
+
+  pointer* items = realloc(stack->items, capacity * sizeof(pointer));
+  if (NULL == items) {
+    DIE("Ran out of space for CC mark stack!\n");
+  }
+  stack->items = items;
+  stack->capacity = capacity;
+}
+
+static inline void markStackPush(CC_markStack* stack, pointer p) {
+  markStackReserve(stack, 1);
+  stack->items[stack->size++] = p;
+}
+
+/* Move up to CC_MARK_SHARE_BATCH objects from the top of one stack to
+ * another. */
+static void markStackTransfer(CC_markStack* from, CC_markStack* to) {
+  size_t n = (from->size < CC_MARK_SHARE_BATCH) ? from->size : CC_MARK_SHARE_BATCH;
+  markStackReserve(to, n);
+  memcpy(&(to->items[to->size]), &(from->items[from->size - n]), n * sizeof(pointer));
+  to->size += n;
+  from->size -= n;
+}
+
+/* Flip the mark bit of p to `mark`, returning whether this call did so. Safe
+ * against other workers racing to flip the same bit. */
+static inline bool tryFlipMark(pointer p, bool mark) {
+  GC_header* headerp = getHeaderp(p);
+  while (TRUE) {
+    GC_header header = *headerp;
+    if (((header & MARK_MASK) == MARK_MASK) == mark)
+      return FALSE;
+    if (__sync_bool_compare_and_swap(headerp, header, header ^ MARK_MASK))
+      return TRUE;
+  }
+}
+
+static void scanMarkStack(GC_state s, ConcurrentCollectArgs* args, bool sharing) {
+  CC_markStack* stack = args->markStack;
+  struct GC_foreachObjptrClosure scanClosure =
+  {.fun = args->scanFun, .env = args};
+
+  while (stack->size > 0) {
+    pointer p = stack->items[--(stack->size)];
+    foreachObjptrInObject(s, p, &trueObjptrPredicateClosure, &scanClosure, FALSE);
+    if (NULL != args->shareTable) {
+      shareFieldsOf(s, p, args);
+    }
+
+    /* keep the pool stocked while others might be starving */
+    if (sharing &&
+        stack->size > 2 * CC_MARK_SHARE_BATCH &&
+        0 == *((volatile size_t*)&(CC_markPool.work.size)))
+    {
+      spinlock_lock(&(CC_markPool.lock), Proc_processorNumber(s));
+      markStackTransfer(stack, &(CC_markPool.work));
+      spinlock_unlock(&(CC_markPool.lock));
+    }
+  }
+}
+
+/* Trace until no worker holds any work. The collector closes the pool on the
+ * way out; a helper may also leave early if it has found nothing to do for a
+ * while. */
+static void markWithPool(GC_state s, ConcurrentCollectArgs* args, bool isCollector) {
+  uint32_t me = Proc_processorNumber(s);
+  bool holding = isCollector;
+  size_t emptyPolls = 0;
+
+  while (TRUE) {
+    if (holding) {
+      scanMarkStack(s, args, TRUE);
+    }
+
+    spinlock_lock(&(CC_markPool.lock), me);
+    if (holding) {
+      CC_markPool.busy--;
+      holding = FALSE;
+    }
+
+    if (CC_markPool.work.size > 0) {
+      markStackTransfer(&(CC_markPool.work), args->markStack);
+      CC_markPool.busy++;
+      holding = TRUE;
+      emptyPolls = 0;
+    }
+    else if (isCollector && 0 == CC_markPool.busy) {
+      CC_markPool.open = FALSE;
+      spinlock_unlock(&(CC_markPool.lock));
+      return;
+    }
+    else if (!isCollector &&
+             (0 == CC_markPool.busy ||
+              !CC_markPool.open ||
+              ++emptyPolls >= CC_HELPER_PATIENCE))
+    {
+      spinlock_unlock(&(CC_markPool.lock));
+      return;
+    }
+    spinlock_unlock(&(CC_markPool.lock));
+  }
+}
+
+/* Scan everything reachable from args->markStack. A root collection shares
+ * the work with idle workers; other collections trace on their own. */
+static void markToCompletion(GC_state s, ConcurrentCollectArgs* args, bool parallel) {
+  if (!parallel) {
+    scanMarkStack(s, args, FALSE);
+    return;
+  }
+
+  spinlock_lock(&(CC_markPool.lock), Proc_processorNumber(s));
+  assert(!CC_markPool.open);
+  assert(0 == CC_markPool.helpers);
+  assert(0 == CC_markPool.work.size);
+  CC_markPool.args = args;
+  CC_markPool.busy = 1;
+  __sync_synchronize();
+  CC_markPool.open = TRUE;
+  spinlock_unlock(&(CC_markPool.lock));
+
+  markWithPool(s, args, TRUE);
+
+  /* helpers may still be reading args on their way out */
+  while (CC_markPool.helpers > 0) {}
+  CC_markPool.args = NULL;
+}
+
+void CC_helpCollectAtRoot(void) {
+  if (!CC_markPool.open) {
+    return;
+  }
+
+  GC_state s = pthread_getspecific (gcstate_key);
+  spinlock_lock(&(CC_markPool.lock), Proc_processorNumber(s));
+  if (!CC_markPool.open) {
+    spinlock_unlock(&(CC_markPool.lock));
+    return;
+  }
+  CC_markPool.helpers++;
+  ConcurrentCollectArgs args = *(CC_markPool.args);
+  spinlock_unlock(&(CC_markPool.lock));
+
+  CC_markStack stack;
+  markStackInit(&stack);
+  args.markStack = &stack;
+
+  markWithPool(s, &args, FALSE);
+
+  assert(0 == stack.size);
+  markStackFree(&stack);
+  __sync_fetch_and_sub(&(CC_markPool.helpers), 1);
+}
+
 bool isInScope(HM_chunk chunk, ConcurrentCollectArgs* args) {
   return chunk->tmpHeap == args->fromHead;
 }
@@ -106,15 +322,28 @@ void CC_HM_unlinkChunk(HM_chunkList list, HM_chunk chunk) {
   chunk->nextChunk = NULL;
 }
 
+// Several workers may race to save the same chunk; the one that moves its
+// tmpHeap from fromHead to toHead does the relinking.
 void saveChunk(HM_chunk chunk, ConcurrentCollectArgs* args) {
+  if (!__sync_bool_compare_and_swap(&(chunk->tmpHeap), args->fromHead, args->toHead)) {
+    assert(chunk->tmpHeap == args->toHead);
+    return;
+  }
+
+  if (NULL != args->listLock) {
+    spinlock_lock(args->listLock,
+                  Proc_processorNumber(pthread_getspecific(gcstate_key)));
+  }
+
   CC_HM_unlinkChunk(args->origList, chunk);
   HM_appendChunk(args->repList, chunk);
 
-  assert(chunk->tmpHeap == args->fromHead);
-  chunk->tmpHeap = args->toHead;
-
   HM_assertChunkListInvariants(args->origList);
   HM_assertChunkListInvariants(args->repList);
+
+  if (NULL != args->listLock) {
+    spinlock_unlock(args->listLock);
+  }
 }
 
 bool saveNoForward(
@@ -135,16 +364,18 @@ bool saveNoForward(
   return (chunkSaved || chunkOrig);
 }
 
-void markAndScan(GC_state s, pointer p, void* rawArgs) {
-  if(!CC_isPointerMarked(p)) {
-    markObj(p);
-    assert(CC_isPointerMarked(p));
-
-    struct GC_foreachObjptrClosure forwardPtrClosure =
-    {.fun = forwardPtrChunk, .env = rawArgs};
+// Credit the object at p to the live bytes of its chunk.
+static inline void noteLiveObject(GC_state s, pointer p) {
+  __sync_fetch_and_add(&(HM_getChunkOf(p)->liveBytes), sizeofObject(s, p));
+}
 
-    foreachObjptrInObject(s, p, &trueObjptrPredicateClosure,
-            &forwardPtrClosure, FALSE);
+// Fields are scanned later, by whichever worker pops p.
+void markAndPush(GC_state s, pointer p, void* rawArgs) {
+  ConcurrentCollectArgs* args = (ConcurrentCollectArgs*)rawArgs;
+  if (tryFlipMark(p, TRUE)) {
+    assert(CC_isPointerMarked(p));
+    noteLiveObject(s, p);
+    markStackPush(args->markStack, p);
   }
 }
 
@@ -208,7 +439,7 @@ void forwardPtrChunk (GC_state s, objptr *opp, void* rawArgs) {
   bool saved = saveNoForward(s, p, rawArgs);
 
   if(saved) {
-    markAndScan(s, p, rawArgs);
+    markAndPush(s, p, rawArgs);
   }
 }
 
@@ -221,7 +452,7 @@ void forwardDownPtrChunk(GC_state s, __attribute__((unused)) objptr dst,
   // forwardPtrChunk(s, &dst, rawArgs);
 }
 
-void unmarkPtrChunk(GC_state s, objptr* opp, void* rawArgs) {
+void unmarkPtrChunk(__attribute__((unused)) GC_state s, objptr* opp, void* rawArgs) {
   objptr op = *opp;
   assert(isObjptr(op));
 
@@ -234,16 +465,10 @@ void unmarkPtrChunk(GC_state s, objptr* opp, void* rawArgs) {
   }
   p = getTransitivePtr(p, rawArgs);
 
-  if(CC_isPointerMarked (p)) {
+  if(tryFlipMark(p, FALSE)) {
     assert(chunk->tmpHeap == ((ConcurrentCollectArgs*)rawArgs)->toHead);
-    markObj(p);
-
     assert(!CC_isPointerMarked(p));
-
-    struct GC_foreachObjptrClosure unmarkPtrClosure =
-    {.fun = unmarkPtrChunk, .env = rawArgs};
-    foreachObjptrInObject(s, p, &trueObjptrPredicateClosure,
-            &unmarkPtrClosure, FALSE);
+    markStackPush(((ConcurrentCollectArgs*)rawArgs)->markStack, p);
   }
 }
 
@@ -258,18 +483,231 @@ void unmarkDownPtrChunk(
   unmarkPtrChunk(s, &dst, rawArgs);
 }
 
+/* ========================================================================= */
+/* Hash consing
+ *
+ * With hash consing on, the unmarking pass of a root collection also merges
+ * duplicate immutable objects. After a worker unmarks the fields of an
+ * object it has popped, it looks up each field's target in a table shared by
+ * all workers and keyed on object contents. If an equal object got there
+ * first, the field is redirected to it with a CAS, so a racing write to the
+ * same field is never lost.
+ *
+ * Equality is shallow: headers, lengths and raw bytes, objptrs included,
+ * must match. Fields are redirected as their holders are popped, so one
+ * collection merges strings and flat tuples, and each later one reaches one
+ * more level of nesting. Duplicates are left where they are; their chunks
+ * are freed by a later collection once nothing else is live in them. */
+
+/* bounds on the number of table slots */
+#define CC_SHARE_MIN_SLOTS ((size_t)1 << 12)
+#define CC_SHARE_MAX_SLOTS ((size_t)1 << 21)
+/* expected bytes per live object, for sizing the table */
+#define CC_SHARE_BYTES_PER_SLOT 16
+/* slots looked at before an object is left alone */
+#define CC_SHARE_MAX_PROBES 32
+/* bytes of an object that go into its hash */
+#define CC_SHARE_HASH_PREFIX 256
+
+struct CC_shareTable {
+  pointer* canonical; /* first object seen with each contents */
+  pointer* duplicates; /* objects already counted in bytesShared */
+  size_t mask;
+  uintmax_t bytesShared;
+};
+
+static volatile bool CC_shareRequested = FALSE;
+
+void CC_requestShare(void) {
+  CC_shareRequested = TRUE;
+}
+
+static struct CC_shareTable* shareTableNew(size_t liveBytes) {
+  size_t slots = CC_SHARE_MIN_SLOTS;
+  while (slots < CC_SHARE_MAX_SLOTS &&
+         slots < liveBytes / CC_SHARE_BYTES_PER_SLOT)
+  {
+    slots *= 2;
+  }
+
+  struct CC_shareTable* table = malloc(sizeof(struct CC_shareTable));
+  table->canonical = calloc(slots, sizeof(pointer));
+  table->duplicates = calloc(slots, sizeof(pointer));
+  if (NULL == table->canonical || NULL == table->duplicates) {
+    DIE("Out of memory for hash-consing table of %zu slots", slots);
+  }
+  table->mask = slots - 1;
+  table->bytesShared = 0;
+  return table;
+}
+
+static void shareTableFree(struct CC_shareTable* table) {
+  free(table->canonical);
+  free(table->duplicates);
+  free(table);
+}
+
+/* Whether p is an immutable object that may be replaced by an equal one. If
+ * so, *bytes is the size of its contents, excluding metadata and padding. */
+static bool isShareable(GC_state s, pointer p, bool* isSequence, size_t* bytes) {
+  GC_objectTypeTag tag;
+  bool hasIdentity;
+  uint16_t bytesNonObjptrs, numObjptrs;
+
+  splitHeader(s, getHeader(p), &tag, &hasIdentity,
+              &bytesNonObjptrs, &numObjptrs);
+  if (hasIdentity) {
+    return FALSE;
+  }
+
+  size_t elementBytes = bytesNonObjptrs + (numObjptrs * OBJPTR_SIZE);
+  if (NORMAL_TAG == tag) {
+    *isSequence = FALSE;
+    *bytes = elementBytes;
+    return TRUE;
+  }
+  if (SEQUENCE_TAG == tag) {
+    *isSequence = TRUE;
+    *bytes = getSequenceLength(p) * elementBytes;
+    return TRUE;
+  }
+  return FALSE;
+}
+
+/* Only the object type is compared; the mark bit and counter may differ
+ * between equal objects. */
+static inline GC_header shareKey(pointer p) {
+  return getHeader(p) & TYPE_INDEX_MASK;
+}
+
+static size_t shareHash(pointer p, bool isSequence, size_t bytes) {
+  uint64_t h = 14695981039346656037ULL;
+  h = (h ^ shareKey(p)) * 1099511628211ULL;
+  if (isSequence) {
+    h = (h ^ getSequenceLength(p)) * 1099511628211ULL;
+  }
+  size_t n = (bytes < CC_SHARE_HASH_PREFIX) ? bytes : CC_SHARE_HASH_PREFIX;
+  for (size_t i = 0; i < n; i++) {
+    h = (h ^ p[i]) * 1099511628211ULL;
+  }
+  return (size_t)(h ^ (h >> 32));
+}
+
+/* Return the canonical object equal to p, making p canonical if there is
+ * none yet. Returns p itself if the probe sequence is full. */
+static pointer shareLookup(
+  struct CC_shareTable* table,
+  pointer p,
+  bool isSequence,
+  size_t bytes)
+{
+  size_t i = shareHash(p, isSequence, bytes) & table->mask;
+  for (size_t probes = 0; probes < CC_SHARE_MAX_PROBES; probes++) {
+    pointer q = table->canonical[i];
+    if (NULL == q) {
+      q = casCC(&(table->canonical[i]), NULL, p);
+      if (NULL == q) {
+        return p;
+      }
+    }
+    if (q == p) {
+      return p;
+    }
+    if (shareKey(q) == shareKey(p) &&
+        (!isSequence || getSequenceLength(q) == getSequenceLength(p)) &&
+        0 == memcmp(q, p, bytes))
+    {
+      return q;
+    }
+    i = (i + 1) & table->mask;
+  }
+  return p;
+}
+
+/* Record that p is a duplicate. Returns whether this is the first time, so
+ * that an object referenced from many fields is counted once. */
+static bool shareNoteDuplicate(struct CC_shareTable* table, pointer p) {
+  size_t i = (size_t)(((uintptr_t)p >> 3) * 11400714819323198485ULL);
+  for (size_t probes = 0; probes < CC_SHARE_MAX_PROBES; probes++) {
+    i &= table->mask;
+    pointer q = table->duplicates[i];
+    if (NULL == q) {
+      q = casCC(&(table->duplicates[i]), NULL, p);
+      if (NULL == q) {
+        return TRUE;
+      }
+    }
+    if (q == p) {
+      return FALSE;
+    }
+    i++;
+  }
+  return FALSE;
+}
+
+void shareField(GC_state s, objptr* opp, void* rawArgs) {
+  ConcurrentCollectArgs* args = (ConcurrentCollectArgs*)rawArgs;
+  objptr op = *opp;
+  pointer p = objptrToPointer(op, NULL);
+
+  // the field was unmarked just before, so p has been pushed if it is live
+  // in this heap. Forwarded objects are left to a later collection.
+  if (!isChunkSaved(HM_getChunkOf(p), args) || hasFwdPtr(p)) {
+    return;
+  }
+
+  bool isSequence;
+  size_t bytes;
+  if (!isShareable(s, p, &isSequence, &bytes)) {
+    return;
+  }
+
+  pointer canonical = shareLookup(args->shareTable, p, isSequence, bytes);
+  if (canonical != p &&
+      __sync_bool_compare_and_swap(opp, op, pointerToObjptr(canonical, NULL)) &&
+      shareNoteDuplicate(args->shareTable, p))
+  {
+    __sync_fetch_and_add(&(args->shareTable->bytesShared), sizeofObject(s, p));
+  }
+}
+
+/* Stacks and weaks are never rewritten: a stack may belong to a running
+ * thread. */
+static void shareFieldsOf(GC_state s, pointer p, ConcurrentCollectArgs* args) {
+  GC_objectTypeTag tag;
+  splitHeader(s, getHeader(p), &tag, NULL, NULL, NULL);
+  if (NORMAL_TAG != tag && SEQUENCE_TAG != tag) {
+    return;
+  }
+
+  struct GC_foreachObjptrClosure shareClosure =
+  {.fun = shareField, .env = args};
+  foreachObjptrInObject(s, p, &trueObjptrPredicateClosure, &shareClosure, FALSE);
+}
+
 // This function does more than forwardPtrChunk.
 // It scans the object pointed by the pointer even if its not in scope.
 // Recursively however it only calls forwardPtrChunk and not itself
-void forceForward(GC_state s, objptr *opp, void* rawArgs) {
-  pointer p = objptrToPointer(*opp, NULL);
-
+static void forceMarkSelf(GC_state s, pointer p, void* rawArgs) {
   bool saved = saveNoForward(s, p, rawArgs);
 
   if(saved && !CC_isPointerMarked(p)) {
     assert(getTransitivePtr(p, rawArgs) == p);
     markObj(p);
+    noteLiveObject(s, p);
   }
+}
+
+static void forceUnmarkSelf(pointer p, __attribute__((unused)) void* rawArgs) {
+  if(CC_isPointerMarked(p)){
+    assert(getTransitivePtr(p, rawArgs) == p);
+    markObj(p);
+  }
+}
+
+void forceForward(GC_state s, objptr *opp, void* rawArgs) {
+  pointer p = objptrToPointer(*opp, NULL);
+  forceMarkSelf(s, p, rawArgs);
 
   struct GC_foreachObjptrClosure forwardPtrClosure =
   {.fun = forwardPtrChunk, .env = rawArgs};
@@ -279,16 +717,32 @@ void forceForward(GC_state s, objptr *opp, void* rawArgs) {
 
 void forceUnmark (GC_state s, objptr* opp, void* rawArgs) {
   pointer p = objptrToPointer(*opp, NULL);
-  if(CC_isPointerMarked(p)){
-    assert(getTransitivePtr(p, rawArgs) == p);
-    markObj(p);
-  }
+  forceUnmarkSelf(p, rawArgs);
+
   struct GC_foreachObjptrClosure unmarkPtrClosure =
   {.fun = unmarkPtrChunk, .env = rawArgs};
   foreachObjptrInObject(s, p, &trueObjptrPredicateClosure,
           &unmarkPtrClosure, FALSE);
 }
 
+/* Like forceForward and forceUnmark on s->wsQueue, but only visiting the
+ * slots of the deque that are in use, not its whole capacity. */
+static void forceForwardDeque(GC_state s, void* rawArgs) {
+  forceMarkSelf(s, objptrToPointer(s->wsQueue, NULL), rawArgs);
+
+  struct GC_foreachObjptrClosure forwardPtrClosure =
+  {.fun = forwardPtrChunk, .env = rawArgs};
+  foreachObjptrInDeque(s, &forwardPtrClosure);
+}
+
+static void forceUnmarkDeque(GC_state s, void* rawArgs) {
+  forceUnmarkSelf(objptrToPointer(s->wsQueue, NULL), rawArgs);
+
+  struct GC_foreachObjptrClosure unmarkPtrClosure =
+  {.fun = unmarkPtrChunk, .env = rawArgs};
+  foreachObjptrInDeque(s, &unmarkPtrClosure);
+}
+
 void ensureCallSanity(__attribute__((unused)) GC_state s,
                      __attribute__((unused)) HM_HierarchicalHeap targetHH,
                       __attribute__((unused))ConcurrentPackage args) {
@@ -413,10 +867,7 @@ void CC_filterDownPointers(GC_state s, HM_chunkList x, HM_HierarchicalHeap hh){
   else {
     y = HM_HH_getRemSet(hh);
   }
-  struct HM_foreachDownptrClosure bucketIfValidAtListClosure =
-  {.fun = bucketIfValidAtList, .env = (void*)x};
-
-  HM_foreachRemembered(s, y, &bucketIfValidAtListClosure);
+  HM_bucketValidRemembered(y, x, FALSE);
   HM_appendChunkList(getFreeListSmall(s), y);
   *y = *x;
 }
@@ -444,11 +895,18 @@ void CC_collectWithRoots(GC_state s, HM_HierarchicalHeap targetHH,
 
   HM_assertChunkListInvariants(origList);
 
+  CC_markStack markStack;
+  markStackInit(&markStack);
+
   ConcurrentCollectArgs lists = {
     .origList = origList,
     .repList  = repList,
     .toHead = (void*)repList,
-    .fromHead = (void*) &(origList)
+    .fromHead = (void*) &(origList),
+    .listLock = (isConcurrent)?&(CC_markPool.listLock):NULL,
+    .markStack = &markStack,
+    .scanFun = forwardPtrChunk,
+    .shareTable = NULL
   };
 
   // JATIN_NOTE: Some HM_hierarchical objects in origList
@@ -468,6 +926,7 @@ void CC_collectWithRoots(GC_state s, HM_HierarchicalHeap targetHH,
     assert(T->tmpHeap == NULL);
     T->tmpHeap = lists.fromHead;
     T->levelHead = targetHH;
+    T->liveBytes = 0;
   }
 
 
@@ -493,7 +952,7 @@ void CC_collectWithRoots(GC_state s, HM_HierarchicalHeap targetHH,
   forceForward(s, &(cp->snapLeft), &lists);
   forceForward(s, &(cp->snapRight), &lists);
   forceForward(s, &(cp->snapTemp), &lists);
-  forceForward(s, &(s->wsQueue), &lists);
+  forceForwardDeque(s, &lists);
   forceForward(s, &(cp->stack), &lists);
 
   // JATIN_NOTE: This is important because the stack object of the thread we are collecting
@@ -503,6 +962,7 @@ void CC_collectWithRoots(GC_state s, HM_HierarchicalHeap targetHH,
   saveNoForward(s, (void*)(thread->stack), &lists);
   saveNoForward(s, (void*)thread, &lists);
   forEachObjptrinStack(s, cp->rootList, forwardPtrChunk, &lists);
+  markToCompletion(s, &lists, isConcurrent);
 
   #if ASSERT
   if (HM_HH_getDepth(targetHH) != 1){
@@ -517,6 +977,17 @@ void CC_collectWithRoots(GC_state s, HM_HierarchicalHeap targetHH,
   }
   #endif
 
+  lists.scanFun = unmarkPtrChunk;
+  if (isConcurrent && (s->controls->hashConsDuringGC || CC_shareRequested)) {
+    CC_shareRequested = FALSE;
+    size_t liveBytes = 0;
+    for (HM_chunk chunk = repList->firstChunk;
+         chunk != NULL; chunk = chunk->nextChunk) {
+      liveBytes += chunk->liveBytes;
+    }
+    lists.shareTable = shareTableNew(liveBytes);
+  }
+
   struct HM_foreachDownptrClosure unmarkDownPtrChunkClosure =
   {.fun = unmarkDownPtrChunk, .env = &lists};
   HM_foreachRemembered(s, &downPtrs, &unmarkDownPtrChunkClosure);
@@ -524,9 +995,18 @@ void CC_collectWithRoots(GC_state s, HM_HierarchicalHeap targetHH,
   forceUnmark(s, &(cp->snapLeft), &lists);
   forceUnmark(s, &(cp->snapRight), &lists);
   forceUnmark(s, &(cp->snapTemp), &lists);
-  forceUnmark(s, &(s->wsQueue), &lists);
+  forceUnmarkDeque(s, &lists);
   forceUnmark(s, &(cp->stack), &lists);
   forEachObjptrinStack(s, cp->rootList, unmarkPtrChunk, &lists);
+  markToCompletion(s, &lists, isConcurrent);
+  markStackFree(&markStack);
+
+  if (NULL != lists.shareTable) {
+    s->cumulativeStatistics->bytesHashConsed += lists.shareTable->bytesShared;
+    s->cumulativeStatistics->numHashConsGCs++;
+    shareTableFree(lists.shareTable);
+    lists.shareTable = NULL;
+  }
 
   #if ASSERT2 // just contains code that is sometimes useful for debugging.
   HM_assertChunkListInvariants(origList);
@@ -574,6 +1054,27 @@ void CC_collectWithRoots(GC_state s, HM_HierarchicalHeap targetHH,
   }
   #endif
 
+  /* Chunks are kept whole if anything in them survived. Measure the dead
+   * space that this leaves behind. The dead space in sparse chunks is left
+   * for the next local collection that reaches this heap, which evacuates
+   * the survivors (see HM_HH_desiredCollectionScope). */
+  uint64_t bytesUnreclaimed = 0;
+  uint64_t numSparseChunks = 0;
+  size_t bytesDeadInSparseChunks = 0;
+  for(HM_chunk chunk = repList->firstChunk;
+    chunk!=NULL; chunk = chunk->nextChunk) {
+    size_t used = (size_t)(HM_getChunkFrontier(chunk) - HM_getChunkStart(chunk));
+    size_t live = chunk->liveBytes;
+    if (live < used) {
+      bytesUnreclaimed += used - live;
+    }
+    if (100 * live < CC_SPARSE_CHUNK_PERCENT * used) {
+      numSparseChunks++;
+      bytesDeadInSparseChunks += used - live;
+    }
+  }
+  cp->bytesDeadInSparseChunks = bytesDeadInSparseChunks;
+
   uint64_t bytesSaved =  HM_getChunkListSize(repList);
   uint64_t bytesScanned =  HM_getChunkListSize(repList)
                           + HM_getChunkListSize(origList);
@@ -597,8 +1098,16 @@ void CC_collectWithRoots(GC_state s, HM_HierarchicalHeap targetHH,
     chunk = tChunk;
   }
 
-  HM_appendChunkList(getFreeListSmall(s), origList);
+  /* The root heap is shared by every processor, so its free chunks go back
+   * to the shared pool rather than to whichever processor ran the CC. */
+  if (isConcurrent) {
+    HM_appendToSharedList(s, origList);
+  } else {
+    HM_appendChunkList(getFreeListSmall(s), origList);
+    HM_coalesceFreeChunks(s);
+  }
   HM_deleteChunks(s, deleteList);
+  HM_decommitFreeChunks(s);
 
   for(HM_chunk chunk = repList->firstChunk;
     chunk!=NULL; chunk = chunk->nextChunk) {
@@ -616,6 +1125,8 @@ void CC_collectWithRoots(GC_state s, HM_HierarchicalHeap targetHH,
     timespec_add(&(s->cumulativeStatistics->timeRootCC), &stopTime);
     s->cumulativeStatistics->numRootCCs++;
     s->cumulativeStatistics->bytesReclaimedByRootCC += bytesScanned-bytesSaved;
+    s->cumulativeStatistics->bytesUnreclaimedByRootCC += bytesUnreclaimed;
+    s->cumulativeStatistics->numSparseChunksByRootCC += numSparseChunks;
   } else {
     timespec_add(&(s->cumulativeStatistics->timeInternalCC), &stopTime);
     s->cumulativeStatistics->numInternalCCs++;
@@ -19,12 +19,30 @@
 
 #if (defined (MLTON_GC_INTERNAL_FUNCS))
 #define LL_Log LL_FORCE
+// A worker's private stack of objects whose mark bit it has flipped but
+// whose fields it has not yet scanned.
+typedef struct CC_markStack {
+	pointer* items;
+	size_t size;
+	size_t capacity;
+} CC_markStack;
+
 // Struct to pass around args. repList is the new chunklist.
+// Every worker taking part in a collection has its own copy, differing only
+// in markStack.
 typedef struct ConcurrentCollectArgs {
 	HM_chunkList origList;
 	HM_chunkList repList;
 	void* toHead;
 	void* fromHead;
+	// Guards origList and repList when several workers save chunks; NULL if
+	// the collection is not shared.
+	spinlock_t* listLock;
+	CC_markStack* markStack;
+	// Applied to every objptr field of each object popped from markStack.
+	GC_foreachObjptrFun scanFun;
+	// Non-NULL while the unmarking pass of a root collection hash-conses.
+	struct CC_shareTable* shareTable;
 } ConcurrentCollectArgs;
 
 
@@ -49,6 +67,9 @@ typedef struct ConcurrentPackage {
 	objptr stack;
 	size_t bytesAllocatedSinceLastCollection;
 	size_t bytesSurvivedLastCollection;
+	// Dead bytes in the sparse chunks that the last collection kept. A local
+	// collection that reaches this heap evacuates them.
+	size_t bytesDeadInSparseChunks;
 	struct HM_chunkList remSet;
 } * ConcurrentPackage;
 
@@ -62,7 +83,15 @@ typedef struct ConcurrentPackage {
 void CC_collectWithRoots(GC_state s, struct HM_HierarchicalHeap * targetHH, GC_thread thread);
 
 void CC_collectAtPublicLevel(GC_state s, GC_thread thread, uint32_t depth);
+
+// Called by idle workers. If a root collection is tracing, helps it until
+// there is no more tracing work to share.
+void CC_helpCollectAtRoot(void);
 void CC_addToStack(ConcurrentPackage cp, pointer p);
+
+// Hash-cons the root heap during the next root collection, even if
+// hashConsDuringGC is off.
+void CC_requestShare(void);
 void CC_initStack(ConcurrentPackage cp);
 
 
@@ -6,107 +6,128 @@
 
 #define MAX(A,B) (((A) > (B)) ? (A) : (B))
 
-static const size_t MINIMUM_CAPACITY = 10;
-
-void CC_stack_init(CC_stack* stack, size_t capacity){
-    stack->size = 0;
-    stack->capacity = MAX(capacity, MINIMUM_CAPACITY);
-    stack->storage = malloc(sizeof(void*) * stack->capacity);
-    pthread_mutex_init(&stack->mutex, NULL);
-    // pthread_cond_init(&stack->empty_condition_variable, NULL);
-    // pthread_cond_init(&stack->full_condition_variable, NULL);
-}
-
-// assumes that the mutex is held
-bool increaseCapacity(CC_stack* stack, int factor){
-    assert(stack->storage!=NULL);
-    void** new_store = (void**) realloc(stack->storage,
-                                    sizeof(void*) * (factor*stack->capacity));
-
-    if(new_store!=NULL){
-        stack->storage = new_store;
-        stack->capacity*=factor;
-        return true;
-    }
-    else {
-        return false;
+// one 4KB page worth of slots, less the segment header
+static const size_t MINIMUM_CAPACITY =
+    (4096 - sizeof(struct CC_stackSegment)) / sizeof(void*);
+
+static CC_stackSegment* newSegment(size_t capacity, CC_stackSegment* next) {
+    CC_stackSegment* seg =
+        calloc(1, sizeof(struct CC_stackSegment) + capacity * sizeof(void*));
+    if (seg == NULL) {
+        DIE("Ran out of space for CC_stack!\n");
     }
+    seg->next = next;
+    seg->capacity = capacity;
+    seg->reserved = 0;
+    seg->scanned = 0;
+    return seg;
 }
 
-// return false if the push failed. true if push succeeds
-bool CC_stack_push(CC_stack* stack, void* datum){
-    pthread_mutex_lock(&stack->mutex);
-
-    if (stack->size == stack->capacity){
-        bool capIncrease = increaseCapacity(stack, 2);
-        if(!capIncrease){
-            DIE("Ran out of space for CC_stack!\n");
-            assert(0);
-        }
+static void freeSegments(CC_stackSegment* seg) {
+    while (seg != NULL) {
+        CC_stackSegment* next = seg->next;
+        free(seg);
+        seg = next;
     }
+}
 
-    stack->storage[stack->size++] = datum;
-    pthread_mutex_unlock(&stack->mutex);
-    return true;
+static inline size_t segmentSize(CC_stackSegment* seg) {
+    size_t reserved = *((volatile size_t*)&(seg->reserved));
+    return (reserved < seg->capacity) ? reserved : seg->capacity;
 }
 
-// two threads can't pop the same stack
-void* CC_stack_pop(CC_stack* stack){
-    void* ret;
-    pthread_mutex_lock(&stack->mutex);
+void CC_stack_init(CC_stack* stack, size_t capacity){
+    stack->top = newSegment(MAX(capacity, MINIMUM_CAPACITY), NULL);
+    stack->pushers = 0;
+    stack->clearing = FALSE;
+}
 
-    if (stack->size == 0){
-        LOG(LM_HH_COLLECTION, LL_FORCE, "assertion that two different threads don't pop failed");
-        assert(0);
+// Announce a push, backing off while a clear is in progress. The
+// fetch-and-add and the fence in CC_stack_clear order the announcement and
+// the flag, so either the clear waits for this push or this push sees the
+// flag and waits for the clear.
+static inline void beginPush(CC_stack* stack) {
+    while (TRUE) {
+        __sync_fetch_and_add(&(stack->pushers), 1);
+        if (!*((volatile bool*)&(stack->clearing)))
+            return;
+        __sync_fetch_and_sub(&(stack->pushers), 1);
+        while (*((volatile bool*)&(stack->clearing))) {}
     }
-    ret = stack->storage[stack->size - 1];
-    stack->size--;
-
-    pthread_mutex_unlock(&stack->mutex);
-
-    return ret;
 }
 
-void* CC_stack_top(CC_stack* stack){
-    void* ret;
-    pthread_mutex_lock(&stack->mutex);
+// Claims a slot in the newest segment, or installs a fresh segment (twice
+// as large) and tries again. Only waits while a clear is in progress.
+// Always returns true.
+bool CC_stack_push(CC_stack* stack, void* datum){
+    assert(datum != NULL);
+
+    beginPush(stack);
+    while (TRUE) {
+        CC_stackSegment* seg = *((CC_stackSegment* volatile*)&(stack->top));
+        size_t idx = __sync_fetch_and_add(&(seg->reserved), 1);
+        if (idx < seg->capacity) {
+            ((void* volatile*)seg->storage)[idx] = datum;
+            break;
+        }
 
-    if (stack->size == 0){
-        LOG(LM_HH_COLLECTION, LL_FORCE, "top query demands a size query");
-        assert(0);
+        CC_stackSegment* bigger = newSegment(2 * seg->capacity, seg);
+        if (!__sync_bool_compare_and_swap(&(stack->top), seg, bigger)) {
+            // someone else grew the stack first; use theirs
+            free(bigger);
+        }
     }
-
-    ret = stack->storage[stack->size - 1];
-
-    // pthread_cond_signal(&stack->full_condition_variable);
-    pthread_mutex_unlock(&stack->mutex);
-
-    return ret;
+    // also orders the store of datum before the clear that waits for us
+    __sync_fetch_and_sub(&(stack->pushers), 1);
+    return true;
 }
 
 size_t CC_stack_size(CC_stack* stack){
-    size_t size;
-    // Not sure if we need mutex here
-    pthread_mutex_lock(&stack->mutex);
-    size = stack->size;
-    pthread_mutex_unlock(&stack->mutex);
-
+    size_t size = 0;
+    for (CC_stackSegment* seg = stack->top; seg != NULL; seg = seg->next) {
+        size += segmentSize(seg);
+    }
     return size;
 }
 
 size_t CC_stack_capacity(CC_stack* stack){
-    return stack->capacity;
+    size_t capacity = 0;
+    for (CC_stackSegment* seg = stack->top; seg != NULL; seg = seg->next) {
+        capacity += seg->capacity;
+    }
+    return capacity;
 }
 
 void CC_stack_free(CC_stack* stack){
-    free(stack->storage);
-    pthread_mutex_destroy(&stack->mutex);
+    freeSegments(stack->top);
+    stack->top = NULL;
 }
 
+// Called by the owner of the heap when registering a new collection, so no
+// collector is scanning the stack. Write barriers may still be pushing, so
+// first shut them out and wait for those already inside CC_stack_push; after
+// that, nothing else touches the segments until the flag drops. If the stack
+// overflowed into several segments, they are replaced by one segment large
+// enough for all of them, so that steady-state pushes stay in a single
+// segment.
 void CC_stack_clear(CC_stack* stack){
-    pthread_mutex_lock(&stack->mutex);
-    stack->size = 0;
-    pthread_mutex_unlock(&stack->mutex);
+    stack->clearing = TRUE;
+    __sync_synchronize();
+    while (*((volatile size_t*)&(stack->pushers)) != 0) {}
+
+    CC_stackSegment* seg = stack->top;
+    if (seg->next == NULL) {
+        memset(seg->storage, 0, segmentSize(seg) * sizeof(void*));
+        seg->scanned = 0;
+        seg->reserved = 0;
+    }
+    else {
+        stack->top = newSegment(CC_stack_capacity(stack), NULL);
+        freeSegments(seg);
+    }
+
+    __sync_synchronize();
+    stack->clearing = FALSE;
 }
 
 
@@ -116,37 +137,35 @@ void forEachObjptrinStack(GC_state s,
                           void* rawArgs){
     if(stack==NULL)
         return;
-    // size can only increase while iterating.
-    // CC_stack_size function requires mutex, therefore it is more efficient to have two loops
-    // the inner loop does not query size and once it's done, we can re-check size
-    // There should be a mutex here. It is present in CC_stack_size, so its okay for now. (not good though)
-
-    // temporary assurance changes ==> haven't proved to be useful so far.
-    pthread_mutex_lock(&stack->mutex);
-    size_t i = 0, size = stack->size;
-    // size_t i = 0, size = CC_stack_size(stack);
+
     struct GC_foreachObjptrClosure fObjptrClosure =
     {.fun = f, .env = rawArgs};
 
-    while(i!=size){
+    for (CC_stackSegment* seg = stack->top; seg != NULL; seg = seg->next) {
+        seg->scanned = 0;
+    }
 
-        while(i!=size){
-            objptr* opp = (objptr*)(&(stack->storage[i]));
-            callIfIsObjptr(s, &fObjptrClosure, opp);
-            i++;
+    // Mutators may keep pushing while we scan, so keep sweeping until a full
+    // pass finds nothing new.
+    bool progress = TRUE;
+    while (progress) {
+        progress = FALSE;
+        for (CC_stackSegment* seg = *((CC_stackSegment* volatile*)&(stack->top));
+             seg != NULL;
+             seg = seg->next)
+        {
+            size_t size = segmentSize(seg);
+            while (seg->scanned < size) {
+                void** slot = &(seg->storage[seg->scanned]);
+                // the slot is claimed by a push in progress (a clear cannot
+                // run under it); wait for the pusher to fill it in
+                while (*((void* volatile*)slot) == NULL) {}
+                callIfIsObjptr(s, &fObjptrClosure, (objptr*)slot);
+                seg->scanned++;
+                progress = TRUE;
+            }
         }
-
-        // unsure about this code too.
-        // #if ASSERT
-        //     size_t size_new = CC_stack_size(stack);
-        //     assert(size_new>=size);
-        //     size = size_new;
-        // #else
-        //     size = CC_stack_size(stack);
-        // #endif
     }
-    pthread_mutex_unlock(&stack->mutex);
 }
 
 #endif
-
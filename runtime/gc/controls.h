@@ -54,7 +54,10 @@ struct GC_controls {
   bool messages; /* Print a message at the start and end of each gc. */
   size_t allocChunkSize;
   size_t blockSize;
-  bool freeListCoalesce;  /* disabled for now */
+  bool freeListCoalesce; /* merge adjacent free chunks after collections */
+  uint32_t decommitIdleTime; /* ms before a free chunk is returned to the OS; 0 = never */
+  size_t maxRSS; /* decommit free chunks eagerly above this heap size; 0 = no cap */
+  bool hashConsDuringGC; /* share duplicate immutable objects in root CCs */
   bool setAffinity; /* whether or not to set processor affinity */
   int32_t affinityBase; /* First processor to use when setting affinity */
   int32_t affinityStride; /* Number of processors between first and second */
@@ -11,8 +11,6 @@ void promoteDownPtr(GC_state s, objptr dst, objptr* field, objptr src, void* raw
 void promoteIfPointingDownIntoLocalScope(GC_state s, objptr* field, void* rawArgs);
 
 
-void bucketIfValid(GC_state s, objptr dst, objptr* field, objptr src, void* args);
-
 /* ========================================================================= */
 
 void HM_deferredPromote(
@@ -25,28 +23,27 @@ void HM_deferredPromote(
 
   uint32_t numLevels = args->maxDepth+1;
 
+  /* numLevels tracks fork depth, which is too deep for VLAs */
+  struct HM_chunkList* downPtrs = malloc(numLevels * sizeof(struct HM_chunkList));
+  HM_HierarchicalHeap* fromSpace = calloc(numLevels, sizeof(HM_HierarchicalHeap));
+  HM_HierarchicalHeap* heaps = calloc(numLevels, sizeof(HM_HierarchicalHeap));
+  if (NULL == downPtrs || NULL == fromSpace || NULL == heaps) {
+    DIE("Ran out of space for deferred promotion of depth %u!\n", args->maxDepth);
+  }
+
   /* First, bucket in-scope downptrs by the level of the downptr origin */
-  struct HM_chunkList downPtrs[numLevels];
   for (uint32_t i = 0; i < numLevels; i++) {
     HM_initChunkList(&(downPtrs[i]));
   }
 
-  struct HM_foreachDownptrClosure bucketIfValidClosure =
-  {.fun = bucketIfValid, .env = &(downPtrs[0])};
-
   for (HM_HierarchicalHeap cursor = args->hh;
        (NULL != cursor) && (HM_HH_getDepth(cursor) >= args->minDepth);
        cursor = cursor->nextAncestor)
   {
-    HM_foreachRemembered(
-      s,
-      HM_HH_getRemSet(cursor),
-      &bucketIfValidClosure);
+    HM_bucketValidRemembered(HM_HH_getRemSet(cursor), &(downPtrs[0]), TRUE);
   }
 
   /* memoize the fromSpace chunkLists for quick access */
-  HM_HierarchicalHeap fromSpace[numLevels];
-  for (uint32_t i = 0; i < numLevels; i++) fromSpace[i] = NULL;
   for (HM_HierarchicalHeap cursor = args->hh;
        NULL != cursor;
        cursor = cursor->nextAncestor)
@@ -117,8 +114,6 @@ void HM_deferredPromote(
 
   /* reinstantiate the hh linked list from new chunkLists that may have been
    * created during promotion */
-  HM_HierarchicalHeap heaps[numLevels];
-  for (uint32_t i = 0; i < numLevels; i++) heaps[i] = NULL;
   for (HM_HierarchicalHeap cursor = args->hh;
        NULL != cursor;
        cursor = cursor->nextAncestor)
@@ -149,6 +144,10 @@ void HM_deferredPromote(
 
   /* return downPtrs[0] to parent */
   HM_appendChunkList(globalDownPtrs, &(downPtrs[0]));
+  args->fromSpace = NULL;
+  free(downPtrs);
+  free(fromSpace);
+  free(heaps);
   return;
 }
 
@@ -173,33 +172,40 @@ bool checkValid(objptr dst, objptr* field, objptr src) {
   return true;
 }
 
-void bucketIfValidAtList(__attribute__((unused)) GC_state s,
-                   objptr dst,
-                   objptr* field,
-                   objptr src,
-                   void* remSet)
+void HM_bucketValidRemembered(
+  HM_chunkList remSet,
+  HM_chunkList buckets,
+  bool byDepth)
 {
-  if(checkValid(dst, field, src)) {
-    HM_remember((HM_chunkList)remSet, dst, field, src);
+  /* Two valid entries for the same field necessarily have the same src (it
+   * is *field) and the same dst (the object containing field), so filtering
+   * on the field alone is enough to drop duplicates. */
+  objptr* seen[HM_REMEMBER_FILTER_SIZE];
+  memset(seen, 0, sizeof(seen));
+
+  for (HM_chunk chunk = HM_getChunkListFirstChunk(remSet);
+       NULL != chunk;
+       chunk = chunk->nextChunk)
+  {
+    struct HM_remembered* r = (struct HM_remembered*)HM_getChunkStart(chunk);
+    struct HM_remembered* end = (struct HM_remembered*)HM_getChunkFrontier(chunk);
+    for (; r < end; r++) {
+      if (!checkValid(r->dst, r->field, r->src))
+        continue;
+
+      size_t slot =
+        ((uintptr_t)r->field / OBJPTR_SIZE) & (HM_REMEMBER_FILTER_SIZE - 1);
+      if (seen[slot] == r->field)
+        continue;
+      seen[slot] = r->field;
+
+      HM_chunkList bucket =
+        byDepth ? &(buckets[HM_getObjptrDepth(r->dst)]) : buckets;
+      HM_remember(bucket, r->dst, r->field, r->src);
+    }
   }
 }
 
-void bucketIfValid(__attribute__((unused)) GC_state s,
-                   objptr dst,
-                   objptr* field,
-                   objptr src,
-                   void* arg)
-{
-
-  struct HM_chunkList* downPtrs = arg;
-  uint32_t dstDepth = HM_getObjptrDepth(dst);
-  bucketIfValidAtList(s, dst, field, src, &(downPtrs[dstDepth]));
-  // if (checkValid(dst, field, src)) {
-  //   struct HM_chunkList* downPtrs = arg;
-  //   HM_remember(&(downPtrs[dstDepth]), dst, field, src);
-  // }
-}
-
 void promoteDownPtr(__attribute__((unused)) GC_state s,
                     __attribute__((unused)) objptr dst,
                     objptr* field,
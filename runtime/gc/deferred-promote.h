@@ -13,6 +13,13 @@ void HM_deferredPromote(
   GC_thread thread,
   HM_chunkList globalDownPtrs,
   struct ForwardHHObjptrArgs* args);
-void bucketIfValidAtList(GC_state s, objptr dst, objptr* field, objptr src, void* remSet);
+
+/* Copy the entries of remSet that are still valid into buckets, dropping
+ * duplicates. If byDepth, each entry goes to buckets[depth of its dst];
+ * otherwise all entries go to buckets[0]. */
+void HM_bucketValidRemembered(
+  HM_chunkList remSet,
+  HM_chunkList buckets,
+  bool byDepth);
 #endif  /* defined (MLTON_GC_INTERNAL_FUNCS) */
 #endif  /* DEFERRED_PROMOTE_H */
@@ -122,8 +122,37 @@ static void displayCumulativeStatistics (FILE *out, struct GC_cumulativeStatisti
            uintmaxToCommaString (cumulativeStatistics->numCardsMarked));
   fprintf (out, "bytes scanned: %s bytes\n",
            uintmaxToCommaString (cumulativeStatistics->bytesScannedMinor));
-  fprintf (out, "bytes hash consed: %s bytes\n",
-           uintmaxToCommaString (cumulativeStatistics->bytesHashConsed));
+  fprintf (out, "bytes hash consed: %s bytes (%s root CCs)\n",
+           uintmaxToCommaString (cumulativeStatistics->bytesHashConsed),
+           uintmaxToCommaString (cumulativeStatistics->numHashConsGCs));
+  fprintf (out, "bytes coalesced: %s bytes (%s chunks)\n",
+           uintmaxToCommaString (cumulativeStatistics->bytesCoalesced),
+           uintmaxToCommaString (cumulativeStatistics->numChunksCoalesced));
+  fprintf (out, "bytes decommitted: %s bytes\n",
+           uintmaxToCommaString (cumulativeStatistics->bytesDecommitted));
+  fprintf (out, "allocation reserve refills: %s\n",
+           uintmaxToCommaString (cumulativeStatistics->numAllocReserveRefills));
+  fprintf (out, "down-pointers remembered: %s\n",
+           uintmaxToCommaString (cumulativeStatistics->numDownPtrsRemembered));
+  fprintf (out, "bytes left unreclaimed by root CC: %s bytes (%s sparse chunks)\n",
+           uintmaxToCommaString (cumulativeStatistics->bytesUnreclaimedByRootCC),
+           uintmaxToCommaString (cumulativeStatistics->numSparseChunksByRootCC));
+  fprintf (out, "bytes recovered by evacuating sparse chunks: %s bytes\n",
+           uintmaxToCommaString (cumulativeStatistics->bytesRecoveredFromSparseChunks));
+  fprintf (out, "steals: %s (%s failed attempts)\n",
+           uintmaxToCommaString (cumulativeStatistics->schedCounters[SCHED_STEALS]),
+           uintmaxToCommaString (cumulativeStatistics->schedCounters[SCHED_FAILED_STEALS]));
+  fprintf (out, "steal distance: %s\n",
+           uintmaxToCommaString (cumulativeStatistics->schedCounters[SCHED_STEAL_DISTANCE]));
+  fprintf (out, "tasks pushed: %s (%s popped locally)\n",
+           uintmaxToCommaString (cumulativeStatistics->schedCounters[SCHED_TASKS_PUSHED]),
+           uintmaxToCommaString (cumulativeStatistics->schedCounters[SCHED_TASKS_POPPED]));
+  fprintf (out, "sequentialized forks: %s\n",
+           uintmaxToCommaString (cumulativeStatistics->schedCounters[SCHED_SEQUENTIAL_FORKS]));
+  fprintf (out, "join time: %s ms\n",
+           uintmaxToCommaString (
+             (uintmax_t)cumulativeStatistics->timeJoin.tv_sec * 1000
+             + (uintmax_t)cumulativeStatistics->timeJoin.tv_nsec / 1000000));
   fprintf (out, "sync for old gen array: %s\n",
            uintmaxToCommaString (cumulativeStatistics->syncForOldGenArray));
   fprintf (out, "sync for new gen array: %s\n",
@@ -57,13 +57,21 @@ struct HM_chunkList* getFreeListSmall(GC_state s) {
   return &(s->freeListSmall);
 }
 
-struct HM_chunkList* HM_getsharedFreeList(GC_state s)  {
-  return s->sharedfreeList;
+struct HM_chunkList* getSpareStacks(GC_state s) {
+  return &(s->spareStacks);
 }
 
+struct HM_chunkList* getAllocReserve(GC_state s) {
+  return &(s->allocReserve);
+}
+
+struct HM_sharedFreePool* HM_getSharedFreePool(GC_state s)  {
+  return s->sharedFreePool;
+}
 
-struct HM_chunkList* getFreeListLarge(GC_state s) {
-  return &(s->freeListLarge);
+
+struct HM_freeChunkIndex* getFreeChunkIndex(GC_state s) {
+  return &(s->freeChunkIndex);
 }
 
 bool GC_getAmOriginal (GC_state s) {
@@ -191,10 +199,23 @@ uintmax_t GC_getRootCCBytesReclaimedOfProc(GC_state s, uint32_t proc) {
   return s->procStates[proc].cumulativeStatistics->bytesReclaimedByRootCC;
 }
 
+uintmax_t GC_getRootCCBytesUnreclaimedOfProc(GC_state s, uint32_t proc) {
+  return s->procStates[proc].cumulativeStatistics->bytesUnreclaimedByRootCC;
+}
+
 uintmax_t GC_getInternalCCBytesReclaimedOfProc(GC_state s, uint32_t proc) {
   return s->procStates[proc].cumulativeStatistics->bytesReclaimedByInternalCC;
 }
 
+pointer GC_getSchedCountersOfProc(GC_state s, uint32_t proc) {
+  return (pointer)(s->procStates[proc].cumulativeStatistics->schedCounters);
+}
+
+uintmax_t GC_getJoinMillisecondsOfProc(GC_state s, uint32_t proc) {
+  struct timespec *t = &(s->procStates[proc].cumulativeStatistics->timeJoin);
+  return (uintmax_t)t->tv_sec * 1000 + (uintmax_t)t->tv_nsec / 1000000;
+}
+
 uintmax_t GC_getLocalGCMillisecondsOfProc(GC_state s, uint32_t proc) {
   struct timespec *t = &(s->procStates[proc].cumulativeStatistics->timeLocalGC);
   return (uintmax_t)t->tv_sec * 1000 + (uintmax_t)t->tv_nsec / 1000000;
@@ -205,9 +226,8 @@ uintmax_t GC_getPromoMillisecondsOfProc(GC_state s, uint32_t proc) {
   return (uintmax_t)t->tv_sec * 1000 + (uintmax_t)t->tv_nsec / 1000000;
 }
 
-__attribute__((noreturn))
-void GC_setHashConsDuringGC(__attribute__((unused)) GC_state s, __attribute__((unused)) bool b) {
-  DIE("GC_setHashConsDuringGC unsupported");
+void GC_setHashConsDuringGC(GC_state s, bool b) {
+  s->controls->hashConsDuringGC = b;
 }
 
 size_t GC_getLastMajorStatisticsBytesLive (GC_state s) {
@@ -41,11 +41,12 @@ struct GC_state {
   objptr wsQueueBot;
   GC_frameInfo frameInfos; /* Array of frame infos. */
   uint32_t frameInfosLength; /* Cardinality of frameInfos array. */
-  struct HM_chunkList freeListSmall;
-  struct HM_chunkList freeListLarge;
-  HM_chunkList sharedfreeList;
-  bool* freeListLock;
+  struct HM_chunkList freeListSmall; /* freed chunks, not yet binned */
+  struct HM_freeChunkIndex freeChunkIndex;
+  struct HM_sharedFreePool* sharedFreePool;
   struct HM_chunkList extraSmallObjects;
+  struct HM_chunkList spareStacks; /* stack chunks of finished threads */
+  struct HM_chunkList allocReserve; /* chunks set aside for heap extension */
   size_t nextChunkAllocSize;
   /* Ordinary globals */
   objptr *globals;
@@ -99,8 +100,10 @@ static inline void setGCStateCurrentThreadAndStack (GC_state s);
 
 static inline struct HM_chunkList* getFreeListExtraSmall(GC_state s);
 static inline struct HM_chunkList* getFreeListSmall(GC_state s);
-static inline struct HM_chunkList* getFreeListLarge(GC_state s);
-struct HM_chunkList* HM_getsharedFreeList(GC_state s);
+static inline struct HM_chunkList* getSpareStacks(GC_state s);
+static inline struct HM_chunkList* getAllocReserve(GC_state s);
+static inline struct HM_freeChunkIndex* getFreeChunkIndex(GC_state s);
+struct HM_sharedFreePool* HM_getSharedFreePool(GC_state s);
 
 
 #endif /* (defined (MLTON_GC_INTERNAL_FUNCS)) */
@@ -136,8 +139,12 @@ PRIVATE uintmax_t GC_getNumInternalCCsOfProc(GC_state s, uint32_t proc);
 PRIVATE uintmax_t GC_getRootCCMillisecondsOfProc(GC_state s, uint32_t proc);
 PRIVATE uintmax_t GC_getInternalCCMillisecondsOfProc(GC_state s, uint32_t proc);
 PRIVATE uintmax_t GC_getRootCCBytesReclaimedOfProc(GC_state s, uint32_t proc);
+PRIVATE uintmax_t GC_getRootCCBytesUnreclaimedOfProc(GC_state s, uint32_t proc);
 PRIVATE uintmax_t GC_getInternalCCBytesReclaimedOfProc(GC_state s, uint32_t proc);
 
+PRIVATE pointer GC_getSchedCountersOfProc(GC_state s, uint32_t proc);
+PRIVATE uintmax_t GC_getJoinMillisecondsOfProc(GC_state s, uint32_t proc);
+
 PRIVATE pointer GC_getCallFromCHandlerThread (GC_state s);
 PRIVATE void GC_setCallFromCHandlerThreads (GC_state s, pointer p);
 PRIVATE pointer GC_getCurrentThread (GC_state s);
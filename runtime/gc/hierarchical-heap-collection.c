@@ -151,9 +151,13 @@ void HM_HHC_collectLocal(uint32_t desiredScope) {
   struct GC_foreachObjptrClosure forwardHHObjptrClosure =
     {.fun = forwardHHObjptr, .env = &forwardHHObjptrArgs};
 
-  size_t sizesBefore[maxDepth+1];
-  for (uint32_t i = 0; i <= maxDepth; i++)
-    sizesBefore[i] = 0;
+  /* Per-level arrays are allocated rather than put on the C stack, because
+   * the fork depth may run into the hundreds of thousands. */
+  size_t* sizesBefore = calloc(maxDepth+1, sizeof(size_t));
+  HM_HierarchicalHeap* toSpace = calloc(maxDepth+1, sizeof(HM_HierarchicalHeap));
+  if (NULL == sizesBefore || NULL == toSpace) {
+    DIE("Ran out of space for local collection of depth %u!\n", maxDepth);
+  }
   size_t totalSizeBefore = 0;
   for (HM_HierarchicalHeap cursor = hh;
        NULL != cursor;
@@ -201,8 +205,6 @@ void HM_HHC_collectLocal(uint32_t desiredScope) {
 
   LOG(LM_HH_COLLECTION, LL_DEBUG, "START root copy");
 
-  HM_HierarchicalHeap toSpace[maxDepth+1];
-  for (uint32_t i = 0; i <= maxDepth; i++) toSpace[i] = NULL;
   forwardHHObjptrArgs.toSpace = &(toSpace[0]);
   forwardHHObjptrArgs.toDepth = HM_HH_INVALID_DEPTH;
   /* forward contents of stack */
@@ -254,12 +256,7 @@ void HM_HHC_collectLocal(uint32_t desiredScope) {
 
   /* forward contents of deque */
   oldObjectCopied = forwardHHObjptrArgs.objectsCopied;
-  foreachObjptrInObject(s,
-                        objptrToPointer(s->wsQueue,
-                                        NULL),
-                        &trueObjptrPredicateClosure,
-                        &forwardHHObjptrClosure,
-                        FALSE);
+  foreachObjptrInDeque(s, &forwardHHObjptrClosure);
   LOG(LM_HH_COLLECTION, LL_DEBUG,
       "Copied %"PRIu64" objects from deque",
       forwardHHObjptrArgs.objectsCopied - oldObjectCopied);
@@ -334,6 +331,14 @@ void HM_HHC_collectLocal(uint32_t desiredScope) {
 
     HM_chunkList level = HM_HH_getChunkList(hhTail);
     HM_chunkList remset = HM_HH_getRemSet(hhTail);
+
+    /* the survivors of sparse chunks left by a concurrent collection have
+     * been evacuated along with everything else */
+    if (NULL != hhTail->concurrentPack) {
+      s->cumulativeStatistics->bytesRecoveredFromSparseChunks +=
+        hhTail->concurrentPack->bytesDeadInSparseChunks;
+    }
+
     if (NULL != remset) {
 #if ASSERT
       /* clear out memory to quickly catch some memory safety errors */
@@ -461,6 +466,9 @@ void HM_HHC_collectLocal(uint32_t desiredScope) {
     }
   }
 
+  free(sizesBefore);
+  free(toSpace);
+
   if (totalSizeAfter > totalSizeBefore) {
     // whoops?
   } else {
@@ -468,6 +476,9 @@ void HM_HHC_collectLocal(uint32_t desiredScope) {
       (totalSizeBefore - totalSizeAfter);
   }
 
+  HM_coalesceFreeChunks(s);
+  HM_decommitFreeChunks(s);
+
   /* enter statistics if necessary */
 
   timespec_now(&stopTime);
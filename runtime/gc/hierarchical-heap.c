@@ -58,6 +58,10 @@ HM_HierarchicalHeap HM_HH_zip(HM_HierarchicalHeap hh1, HM_HierarchicalHeap hh2)
     {
       HM_appendChunkList(HM_HH_getChunkList(hh1), HM_HH_getChunkList(hh2));
       HM_appendChunkList(HM_HH_getRemSet(hh1), HM_HH_getRemSet(hh2));
+      if (NULL != hh1->concurrentPack && NULL != hh2->concurrentPack) {
+        hh1->concurrentPack->bytesDeadInSparseChunks +=
+          hh2->concurrentPack->bytesDeadInSparseChunks;
+      }
 
       hh2->representative = hh1;
 
@@ -232,6 +236,7 @@ HM_HierarchicalHeap HM_HH_new(GC_state s, uint32_t depth)
     hh->concurrentPack->ccstate = CC_UNREG;
     hh->concurrentPack->bytesSurvivedLastCollection = 0;
     hh->concurrentPack->bytesAllocatedSinceLastCollection = 0;
+    hh->concurrentPack->bytesDeadInSparseChunks = 0;
     HM_initChunkList(&(hh->concurrentPack->remSet));
   }
   else {
@@ -631,6 +636,23 @@ uint32_t HM_HH_desiredCollectionScope(GC_state s, GC_thread thread)
     cursor = cursor->nextAncestor;
     sz += HM_getChunkListSize(HM_HH_getChunkList(cursor));
   }
+
+  /* A concurrent collection may have left sparse chunks in an ancestor that
+   * has since become local again. Reach down to it while the budget allows,
+   * so that this collection evacuates them. */
+  for (HM_HierarchicalHeap ancestor = cursor->nextAncestor;
+       NULL != ancestor &&
+       HM_HH_getDepth(ancestor) >= potentialLocalScope &&
+       HM_getChunkListSize(HM_HH_getChunkList(ancestor)) + sz < budget;
+       ancestor = ancestor->nextAncestor)
+  {
+    sz += HM_getChunkListSize(HM_HH_getChunkList(ancestor));
+    if (NULL != ancestor->concurrentPack &&
+        ancestor->concurrentPack->bytesDeadInSparseChunks > 0)
+    {
+      cursor = ancestor;
+    }
+  }
   uint32_t desiredMinDepth = HM_HH_getDepth(cursor);
 
   assert(desiredMinDepth >= minDepthOkayForBudget);
@@ -149,6 +149,9 @@ int processAtMLton (GC_state s, int start, int argc, char **argv,
                  atName,
                  format);
           }
+        } else if (0 == strcmp (arg, "hash-cons")) {
+          i++;
+          s->controls->hashConsDuringGC = TRUE;
         } else if (0 == strcmp (arg, "set-affinity")) {
           i++;
           s->controls->setAffinity = TRUE;
@@ -162,6 +165,19 @@ int processAtMLton (GC_state s, int start, int argc, char **argv,
           if (i == argc || (0 == strcmp (argv[i], "--")))
             die ("%s affinity-stride missing argument.", atName);
           s->controls->affinityStride = stringToInt (argv[i++]);
+        } else if (0 == strcmp (arg, "decommit-idle-time")) {
+          i++;
+          if (i == argc || (0 == strcmp (argv[i], "--")))
+            die ("%s decommit-idle-time missing argument.", atName);
+          int idleTime = stringToInt (argv[i++]);
+          if (idleTime < 0)
+            die ("%s decommit-idle-time must be >= 0", atName);
+          s->controls->decommitIdleTime = (uint32_t)idleTime;
+        } else if (0 == strcmp (arg, "free-list-coalesce")) {
+          i++;
+          if (i == argc || (0 == strcmp (argv[i], "--")))
+            die ("%s free-list-coalesce missing argument.", atName);
+          s->controls->freeListCoalesce = stringToBool (argv[i++]);
         } else if (0 == strcmp (arg, "load-world")) {
           unless (s->controls->mayLoadWorld)
             die ("May not load world.");
@@ -311,6 +327,13 @@ int processAtMLton (GC_state s, int start, int argc, char **argv,
           if (s->controls->hhConfig.collectionThresholdRatio < 1.0) {
             die("%s collection-threshold-ratio must be at least 1.0", atName);
           }
+        } else if (0 == strcmp(arg, "max-rss")) {
+          i++;
+          if (i == argc || (0 == strcmp (argv[i], "--"))) {
+            die ("%s max-rss missing argument.", atName);
+          }
+
+          s->controls->maxRSS = stringToBytes(argv[i++]);
         } else if (0 == strcmp(arg, "min-collection-size")) {
           i++;
           if (i == argc || (0 == strcmp (argv[i], "--"))) {
@@ -369,6 +392,7 @@ int GC_init (GC_state s, int argc, char **argv) {
   s->controls->mayLoadWorld = FALSE; /* incompatible with mpl runtime */
   s->controls->mayProcessAtMLton = TRUE;
   s->controls->messages = FALSE;
+  s->controls->hashConsDuringGC = FALSE;
   s->controls->setAffinity = FALSE;
   s->controls->affinityBase = 0;
   s->controls->affinityStride = 1;
@@ -397,7 +421,9 @@ int GC_init (GC_state s, int argc, char **argv) {
    * a particular size, and if not, set to default. */
   s->controls->allocChunkSize = 0;
 
-  s->controls->freeListCoalesce = FALSE;
+  s->controls->freeListCoalesce = TRUE;
+  s->controls->decommitIdleTime = 1000;
+  s->controls->maxRSS = 0;
 
   s->globalCumulativeStatistics = newGlobalCumulativeStatistics();
   s->cumulativeStatistics = newCumulativeStatistics();
@@ -416,12 +442,11 @@ int GC_init (GC_state s, int argc, char **argv) {
   s->savedThread = BOGUS_OBJPTR;
 
   HM_initChunkList(getFreeListSmall(s));
-  HM_initChunkList(getFreeListLarge(s));
+  HM_initFreeChunkIndex(getFreeChunkIndex(s));
   HM_initChunkList(getFreeListExtraSmall(s));
-  s->sharedfreeList = (HM_chunkList) (malloc (sizeof(struct HM_chunkList)));
-  HM_initChunkList(s->sharedfreeList);
-  s->freeListLock = (bool*) (malloc(sizeof(bool)));
-  *(s->freeListLock) = false;
+  HM_initChunkList(getSpareStacks(s));
+  HM_initChunkList(getAllocReserve(s));
+  s->sharedFreePool = HM_newSharedFreePool();
 
   s->signalHandlerThread = BOGUS_OBJPTR;
   s->signalsInfo.amInSignalHandler = FALSE;
@@ -536,10 +561,11 @@ void GC_duplicate (GC_state d, GC_state s) {
   d->wsQueueTop = BOGUS_OBJPTR;
   d->wsQueueBot = BOGUS_OBJPTR;
   HM_initChunkList(getFreeListSmall(d));
-  HM_initChunkList(getFreeListLarge(d));
+  HM_initFreeChunkIndex(getFreeChunkIndex(d));
   HM_initChunkList(getFreeListExtraSmall(d));
-  d->sharedfreeList = s->sharedfreeList;
-  d->freeListLock = s->freeListLock;
+  HM_initChunkList(getSpareStacks(d));
+  HM_initChunkList(getAllocReserve(d));
+  d->sharedFreePool = s->sharedFreePool;
   d->nextChunkAllocSize = s->nextChunkAllocSize;
   d->lastMajorStatistics = newLastMajorStatistics();
   d->numberOfProcs = s->numberOfProcs;
@@ -49,3 +49,24 @@ uint32_t pollCurrentLocalScope(GC_state s) {
   uint32_t *bot = (uint32_t*)objptrToPointer(s->wsQueueBot, NULL);
   return *bot;
 }
+
+void foreachObjptrInDeque(GC_state s, struct GC_foreachObjptrClosure* f) {
+  pointer data = objptrToPointer(s->wsQueue, NULL);
+  GC_sequenceLength limit = getSequenceLength(data);
+
+  if (BOGUS_OBJPTR != s->wsQueueTop && BOGUS_OBJPTR != s->wsQueueBot) {
+    uint64_t topval = *(uint64_t*)objptrToPointer(s->wsQueueTop, NULL);
+    uint32_t bot = *(uint32_t*)objptrToPointer(s->wsQueueBot, NULL);
+    uint32_t idx = UNPACK_IDX(topval);
+
+    /* The slot at bot itself may be in use: a push writes it before
+     * advancing bot, and claiming the local scope lowers bot past a
+     * pushed task. */
+    GC_sequenceLength inUse = (GC_sequenceLength)(bot > idx ? bot : idx) + 1;
+    if (inUse < limit)
+      limit = inUse;
+  }
+
+  for (GC_sequenceLength i = 0; i < limit; i++)
+    callIfIsObjptr(s, f, &(((objptr*)data)[i]));
+}
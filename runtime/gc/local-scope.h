@@ -9,7 +9,8 @@
 
 #if (defined (MLTON_GC_INTERNAL_TYPES))
 
-#define DEQUE_CAPACITY_BITS   10
+/* Must match capacityPow in basis-library/schedulers/shh/queue/DequeABP.sml */
+#define DEQUE_CAPACITY_BITS   20
 #define MAX_IDX               ((((uint64_t)1) << DEQUE_CAPACITY_BITS) - 1)
 #define UNPACK_TAG(topval)    ((topval) >> DEQUE_CAPACITY_BITS)
 #define UNPACK_IDX(topval)    ((topval) & MAX_IDX)
@@ -24,6 +25,10 @@ void releaseLocalScope(GC_state s, uint32_t oldbot);
 
 uint32_t pollCurrentLocalScope(GC_state s);
 
+/* Apply f to each slot of this processor's deque that may hold a task,
+ * i.e. up to max(bot, top); the slots above that are always empty. */
+void foreachObjptrInDeque(GC_state s, struct GC_foreachObjptrClosure* f);
+
 #endif /* defined (MLTON_GC_INTERNAL_FUNCS) */
 
 #endif /* LOCAL_SCOPE_H_ */
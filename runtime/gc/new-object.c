@@ -137,18 +137,27 @@ GC_thread newThreadWithHeap(GC_state s, size_t reserved, uint32_t depth) {
 
   /* note that new heaps are initialized with one free chunk */
   HM_chunk tChunk = HM_getChunkListFirstChunk(HM_HH_getChunkList(hh));
-  HM_chunk sChunk = HM_allocateChunk(HM_HH_getChunkList(hh), stackSize);
-  if (NULL == sChunk) {
-    DIE("Ran out of space for stack allocation!");
+  HM_chunk sChunk = takeSpareStack(s, reserved);
+  if (NULL != sChunk) {
+    /* keep the spare's (possibly larger) reservation, which its chunk
+     * frontier already accounts for */
+    reserved = ((GC_stack)(HM_getChunkStart(sChunk) + GC_STACK_METADATA_SIZE))->reserved;
+    stackSize = sizeofStackWithMetaData(s, reserved);
+    HM_appendChunk(HM_HH_getChunkList(hh), sChunk);
+  } else {
+    sChunk = HM_allocateChunk(HM_HH_getChunkList(hh), stackSize);
+    if (NULL == sChunk) {
+      DIE("Ran out of space for stack allocation!");
+    }
   }
   sChunk->levelHead = hh;
   sChunk->mightContainMultipleObjects = FALSE;
 
   assert(threadSize < HM_getChunkSizePastFrontier(tChunk));
-  assert(stackSize < HM_getChunkSizePastFrontier(sChunk));
+  assert(stackSize <= (size_t)(HM_getChunkLimit(sChunk) - HM_getChunkStart(sChunk)));
 
   pointer tFrontier = HM_getChunkFrontier(tChunk);
-  pointer sFrontier = HM_getChunkFrontier(sChunk);
+  pointer sFrontier = HM_getChunkStart(sChunk);
 
   /* Next, allocate+init the thread within the heap that we just created. */
   *((GC_header*)tFrontier) = GC_THREAD_HEADER;
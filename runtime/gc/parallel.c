@@ -1,6 +1,10 @@
 #include <pthread.h>
 #include <time.h>
 #include "platform.h"
+#if (defined (__linux__))
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
 
 void Parallel_init (void) {
   GC_state s = pthread_getspecific (gcstate_key);
@@ -155,6 +159,113 @@ uint64_t Parallel_getTimeInGC (void) {
   return gcTime;
 }
 
+// idle worker parking
+
+/* Idle workers park on a single event count. A worker that wants to park
+ * reads the epoch, announces itself to the scheduler, checks once more for
+ * work, and then sleeps until the epoch moves. Waking a worker bumps the
+ * epoch before the futex wake, so a wake that lands between the epoch read
+ * and the futex wait is never lost. The wait is always bounded so that a
+ * parked worker also notices termination requests.
+ */
+static volatile uint32_t Parallel_parkEpoch = 0;
+
+Word32 Parallel_idleEpoch (void) {
+  __sync_synchronize ();
+  return Parallel_parkEpoch;
+}
+
+void Parallel_park (Word32 epoch, Word64 timeoutNs) {
+  GC_state s = pthread_getspecific (gcstate_key);
+  struct timespec timeout;
+
+  timeout.tv_sec = timeoutNs / 1000000000;
+  timeout.tv_nsec = timeoutNs % 1000000000;
+
+  if (Parallel_parkEpoch == epoch && !GC_CheckForTerminationRequest (s)) {
+#if (defined (__linux__))
+    syscall (SYS_futex, &Parallel_parkEpoch, FUTEX_WAIT_PRIVATE,
+             epoch, &timeout, NULL, 0);
+#else
+    nanosleep (&timeout, NULL);
+#endif
+  }
+
+  GC_MayTerminateThread (s);
+}
+
+void Parallel_wakeParked (Word32 count) {
+  __sync_add_and_fetch (&Parallel_parkEpoch, 1);
+#if (defined (__linux__))
+  syscall (SYS_futex, &Parallel_parkEpoch, FUTEX_WAKE_PRIVATE,
+           count, NULL, NULL, 0);
+#else
+  (void)count;
+#endif
+}
+
+// processor locality
+
+/* Victim selection in the scheduler prefers nearby processors. Locality is
+ * only known when workers are pinned (@mpl set-affinity), in which case
+ * processor p runs on cpu p*affinityStride + affinityBase and we look up
+ * that cpu's core and socket in sysfs. Otherwise, or if sysfs is not
+ * available, every pair of processors is reported as level 1.
+ */
+static int32_t* Parallel_coreIds = NULL;
+static int32_t* Parallel_socketIds = NULL;
+static pthread_once_t Parallel_topologyOnce = PTHREAD_ONCE_INIT;
+
+static int32_t readTopologyId (int32_t cpu, const char* name) {
+  char path[128];
+  FILE* f;
+  int32_t id = -1;
+
+  snprintf (path, sizeof (path),
+            "/sys/devices/system/cpu/cpu%d/topology/%s", cpu, name);
+  f = fopen (path, "r");
+  if (NULL == f)
+    return -1;
+  if (1 != fscanf (f, "%d", &id))
+    id = -1;
+  fclose (f);
+  return id;
+}
+
+static void initTopology (void) {
+  GC_state s = pthread_getspecific (gcstate_key);
+  uint32_t n = s->numberOfProcs;
+
+  Parallel_coreIds = (int32_t*)malloc_safe (n * sizeof (int32_t));
+  Parallel_socketIds = (int32_t*)malloc_safe (n * sizeof (int32_t));
+
+  for (uint32_t p = 0; p < n; p++) {
+    int32_t cpu = (int32_t)p * s->controls->affinityStride
+                  + s->controls->affinityBase;
+    if (s->controls->setAffinity && n > 1) {
+      Parallel_coreIds[p] = readTopologyId (cpu, "core_id");
+      Parallel_socketIds[p] = readTopologyId (cpu, "physical_package_id");
+    } else {
+      Parallel_coreIds[p] = -1;
+      Parallel_socketIds[p] = -1;
+    }
+  }
+}
+
+/* 0 if p and q share a core (hyperthreads), 1 if they share a socket,
+ * 2 if they are on different sockets. */
+Word32 Parallel_localityLevel (Word32 p, Word32 q) {
+  pthread_once (&Parallel_topologyOnce, initTopology);
+
+  if (Parallel_socketIds[p] < 0 || Parallel_socketIds[q] < 0)
+    return 1;
+  if (Parallel_socketIds[p] != Parallel_socketIds[q])
+    return 2;
+  if (Parallel_coreIds[p] >= 0 && Parallel_coreIds[p] == Parallel_coreIds[q])
+    return 0;
+  return 1;
+}
+
 // fetchAndAdd implementations
 
 Int8 Parallel_fetchAndAdd8 (pointer p, Int8 v) {
@@ -16,6 +16,12 @@ PRIVATE Word64 Parallel_maxBytesLive (void);
 PRIVATE void Parallel_resetBytesLive (void);
 PRIVATE Word64 Parallel_getTimeInGC (void);
 
+PRIVATE Word32 Parallel_idleEpoch (void);
+PRIVATE void Parallel_park (Word32 epoch, Word64 timeoutNs);
+PRIVATE void Parallel_wakeParked (Word32 count);
+
+PRIVATE Word32 Parallel_localityLevel (Word32 p, Word32 q);
+
 PRIVATE Int8 Parallel_fetchAndAdd8 (pointer p, Int8 v);
 PRIVATE Int16 Parallel_fetchAndAdd16 (pointer p, Int16 v);
 PRIVATE Int32 Parallel_fetchAndAdd32 (pointer p, Int32 v);
@@ -4,8 +4,26 @@
  * See the file MLton-LICENSE for details.
  */
 
+/* A loop that repeatedly writes the same down-pointer into the same field
+ * would otherwise append one entry per write. Look back over the most recent
+ * entries of the tail chunk and drop the write if it is already there. */
+static inline bool recentlyRemembered(HM_chunk chunk, objptr* field, objptr src) {
+  struct HM_remembered* start = (struct HM_remembered*)HM_getChunkStart(chunk);
+  struct HM_remembered* r = (struct HM_remembered*)HM_getChunkFrontier(chunk);
+  for (int i = 0; i < HM_REMEMBER_DEDUP_WINDOW && r > start; i++) {
+    r--;
+    if (r->field == field && r->src == src)
+      return TRUE;
+  }
+  return FALSE;
+}
+
 void HM_remember(HM_chunkList remSet, objptr dst, objptr* field, objptr src) {
   HM_chunk chunk = HM_getChunkListLastChunk(remSet);
+  if (NULL != chunk && recentlyRemembered(chunk, field, src)) {
+    return;
+  }
+
   if (NULL == chunk || (size_t)(chunk->limit - chunk->frontier) < sizeof(struct HM_remembered)) {
     chunk = HM_allocateChunk(remSet, sizeof(struct HM_remembered));
   }
@@ -30,16 +48,17 @@ void HM_foreachRemembered(
   HM_foreachDownptrClosure f)
 {
   assert(remSet != NULL);
-  HM_chunk chunk = HM_getChunkListFirstChunk(remSet);
-  while (chunk != NULL) {
-    pointer p = HM_getChunkStart(chunk);
-    pointer frontier = HM_getChunkFrontier(chunk);
-    while (p < frontier) {
-      struct HM_remembered* r = (struct HM_remembered*)p;
-      f->fun(s, r->dst, r->field, r->src, f->env);
-      p += sizeof(struct HM_remembered);
+  HM_foreachDownptrFun fun = f->fun;
+  void* env = f->env;
+  for (HM_chunk chunk = HM_getChunkListFirstChunk(remSet);
+       chunk != NULL;
+       chunk = chunk->nextChunk)
+  {
+    struct HM_remembered* r = (struct HM_remembered*)HM_getChunkStart(chunk);
+    struct HM_remembered* end = (struct HM_remembered*)HM_getChunkFrontier(chunk);
+    for (; r < end; r++) {
+      fun(s, r->dst, r->field, r->src, env);
     }
-    chunk = chunk->nextChunk;
   }
 }
 
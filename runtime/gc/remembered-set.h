@@ -11,13 +11,24 @@
 #if (defined (MLTON_GC_INTERNAL_TYPES))
 
 /* Remembering *field = src
- * field must be an internal pointer of dst */
+ * field must be an internal pointer of dst
+ *
+ * Entries are laid out back-to-back in the chunks of a remembered set, so a
+ * chunk's [start, frontier) range can be walked as a plain array. */
 struct HM_remembered {
   objptr dst;
   objptr* field;
   objptr src;
 };
 
+/* Number of trailing entries HM_remember checks for an identical entry
+ * before appending a new one. */
+#define HM_REMEMBER_DEDUP_WINDOW 8
+
+/* Size of the direct-mapped field filter used to drop duplicate entries when
+ * remembered sets are bucketed. Must be a power of two. */
+#define HM_REMEMBER_FILTER_SIZE 256
+
 typedef void (*HM_foreachDownptrFun)(GC_state s, objptr dst, objptr* field, objptr src, void* args);
 
 typedef struct HM_foreachDownptrClosure {
@@ -7,6 +7,8 @@
  * See the file MLton-LICENSE for details.
  */
 
+#include <sys/uio.h>
+
 /* getSequenceLengthp (p)
  *
  * Returns a pointer to the length for the sequence pointed to by p.
@@ -88,3 +90,49 @@ void GC_sequenceCopy (GC_state s, pointer ad, size_t ds, pointer as, size_t ss,
   eltSize = bytesNonObjptrs + (numObjptrs * OBJPTR_SIZE);
   GC_memmove (as + eltSize * ss, ad + eltSize * ds, eltSize * l);
 }
+
+/* GC_writevSequences (fd, seqs, bounds, count)
+ *
+ * Write count byte ranges to fd, in order, with as few system calls as
+ * possible. seqs is a sequence of pointers to byte sequences (strings or
+ * Word8 vectors), and range i is bounds[2i+1] bytes starting bounds[2i]
+ * bytes into seqs[i]. Interrupted and partial writes are continued.
+ * Returns 0, or -1 with errno set.
+ */
+#define WRITEV_BATCH 64
+
+C_Errno_t(C_Int_t) GC_writevSequences (C_Int_t fd, pointer seqs, pointer bounds, C_Size_t count) {
+  struct iovec iov[WRITEV_BATCH];
+  objptr* ops = (objptr*)seqs;
+  int64_t* bs = (int64_t*)bounds;
+
+  for (size_t i = 0; i < count; ) {
+    size_t n = 0;
+    for (; n < WRITEV_BATCH && i + n < count; n++) {
+      iov[n].iov_base = objptrToPointer (ops[i+n], NULL) + bs[2*(i+n)];
+      iov[n].iov_len = (size_t)bs[2*(i+n)+1];
+    }
+    i += n;
+
+    struct iovec* v = iov;
+    while (n > 0) {
+      ssize_t written = writev (fd, v, (int)n);
+      if (written < 0) {
+        if (EINTR == errno)
+          continue;
+        return -1;
+      }
+      while (n > 0 && (size_t)written >= v->iov_len) {
+        written -= v->iov_len;
+        v++;
+        n--;
+      }
+      if (n > 0) {
+        v->iov_base = (char*)v->iov_base + written;
+        v->iov_len -= written;
+      }
+    }
+  }
+
+  return 0;
+}
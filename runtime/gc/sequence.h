@@ -62,3 +62,4 @@ static inline pointer indexSequenceAtObjptrIndex (GC_state s, pointer a,
 
 PRIVATE uintmax_t GC_getSequenceLength (pointer a);
 PRIVATE void GC_sequenceCopy (GC_state s, pointer ad, size_t ds, pointer as, size_t ss, size_t l);
+PRIVATE C_Errno_t(C_Int_t) GC_writevSequences (C_Int_t fd, pointer seqs, pointer bounds, C_Size_t count);
@@ -7,9 +7,11 @@
  * See the file MLton-LICENSE for details.
  */
 
-__attribute__((noreturn))
+/* The hierarchical heap can't be walked from one object without stopping
+ * every processor, so MLton.share instead asks the next root collection to
+ * hash-cons the whole root heap. */
 void GC_share (__attribute__((unused)) GC_state s,
                __attribute__((unused)) pointer object)
 {
-  DIE("GC_share unsupported");
+  CC_requestShare();
 }
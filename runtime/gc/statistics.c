@@ -49,6 +49,11 @@ struct GC_cumulativeStatistics *newCumulativeStatistics(void) {
   cumulativeStatistics->bytesReclaimedByLocal = 0;
   cumulativeStatistics->bytesReclaimedByRootCC = 0;
   cumulativeStatistics->bytesReclaimedByInternalCC = 0;
+  cumulativeStatistics->bytesUnreclaimedByRootCC = 0;
+  cumulativeStatistics->numSparseChunksByRootCC = 0;
+  cumulativeStatistics->bytesRecoveredFromSparseChunks = 0;
+  cumulativeStatistics->bytesCoalesced = 0;
+  cumulativeStatistics->bytesDecommitted = 0;
   cumulativeStatistics->maxBytesLive = 0;
   cumulativeStatistics->maxBytesLiveSinceReset = 0;
   cumulativeStatistics->maxHeapSize = 0;
@@ -64,11 +69,14 @@ struct GC_cumulativeStatistics *newCumulativeStatistics(void) {
   cumulativeStatistics->numCardsMarked = 0;
   cumulativeStatistics->numCopyingGCs = 0;
   cumulativeStatistics->numHashConsGCs = 0;
+  cumulativeStatistics->numDownPtrsRemembered = 0;
   cumulativeStatistics->numMarkCompactGCs = 0;
   cumulativeStatistics->numMinorGCs = 0;
   cumulativeStatistics->numHHLocalGCs = 0;
   cumulativeStatistics->numRootCCs = 0;
   cumulativeStatistics->numInternalCCs = 0;
+  cumulativeStatistics->numChunksCoalesced = 0;
+  cumulativeStatistics->numAllocReserveRefills = 0;
 
   cumulativeStatistics->timeLocalGC.tv_sec = 0;
   cumulativeStatistics->timeLocalGC.tv_nsec = 0;
@@ -79,6 +87,11 @@ struct GC_cumulativeStatistics *newCumulativeStatistics(void) {
   cumulativeStatistics->timeInternalCC.tv_sec = 0;
   cumulativeStatistics->timeInternalCC.tv_nsec = 0;
 
+  for (int i = 0; i < NUM_SCHED_COUNTERS; i++)
+    cumulativeStatistics->schedCounters[i] = 0;
+  cumulativeStatistics->timeJoin.tv_sec = 0;
+  cumulativeStatistics->timeJoin.tv_nsec = 0;
+
   rusageZero (&cumulativeStatistics->ru_gc);
   rusageZero (&cumulativeStatistics->ru_gcCopying);
   rusageZero (&cumulativeStatistics->ru_gcMarkCompact);
@@ -254,6 +267,84 @@ void S_outputCumulativeStatisticsJSON(
     fprintf(out, ", ");
 
     fprintf(out, "\"bytesHashConsed\" : %"PRIuMAX, statistics->bytesHashConsed);
+
+    fprintf(out, ", ");
+
+    fprintf(out, "\"numHashConsGCs\" : %"PRIuMAX, statistics->numHashConsGCs);
+
+    fprintf(out, ", ");
+
+    fprintf(out, "\"bytesCoalesced\" : %"PRIuMAX, statistics->bytesCoalesced);
+
+    fprintf(out, ", ");
+
+    fprintf(out,
+            "\"numChunksCoalesced\" : %"PRIuMAX,
+            statistics->numChunksCoalesced);
+
+    fprintf(out, ", ");
+
+    fprintf(out,
+            "\"bytesDecommitted\" : %"PRIuMAX,
+            statistics->bytesDecommitted);
+
+    fprintf(out, ", ");
+
+    fprintf(out,
+            "\"numAllocReserveRefills\" : %"PRIuMAX,
+            statistics->numAllocReserveRefills);
+
+    fprintf(out, ", ");
+
+    fprintf(out,
+            "\"numDownPtrsRemembered\" : %"PRIuMAX,
+            statistics->numDownPtrsRemembered);
+
+    fprintf(out, ", ");
+
+    fprintf(out,
+            "\"bytesUnreclaimedByRootCC\" : %"PRIuMAX,
+            statistics->bytesUnreclaimedByRootCC);
+
+    fprintf(out, ", ");
+
+    fprintf(out,
+            "\"numSparseChunksByRootCC\" : %"PRIuMAX,
+            statistics->numSparseChunksByRootCC);
+
+    fprintf(out, ", ");
+
+    fprintf(out,
+            "\"bytesRecoveredFromSparseChunks\" : %"PRIuMAX,
+            statistics->bytesRecoveredFromSparseChunks);
+
+    fprintf(out, ", ");
+
+    fprintf(out, "\"schedStats\" : ");
+    fprintf(out, "{ ");
+    {
+      uint64_t* c = statistics->schedCounters;
+      struct timespec* t = &(statistics->timeJoin);
+
+      fprintf(out, "\"steals\" : %"PRIu64, c[SCHED_STEALS]);
+      fprintf(out, ", ");
+      fprintf(out, "\"failedSteals\" : %"PRIu64, c[SCHED_FAILED_STEALS]);
+      fprintf(out, ", ");
+      fprintf(out, "\"stealDistance\" : %"PRIu64, c[SCHED_STEAL_DISTANCE]);
+      fprintf(out, ", ");
+      fprintf(out, "\"tasksPushed\" : %"PRIu64, c[SCHED_TASKS_PUSHED]);
+      fprintf(out, ", ");
+      fprintf(out, "\"tasksPopped\" : %"PRIu64, c[SCHED_TASKS_POPPED]);
+      fprintf(out, ", ");
+      fprintf(out,
+              "\"sequentialForks\" : %"PRIu64,
+              c[SCHED_SEQUENTIAL_FORKS]);
+      fprintf(out, ", ");
+      fprintf(out,
+              "\"joinTime\" : %"PRIuMAX,
+              (uintmax_t)t->tv_sec * 1000 + (uintmax_t)t->tv_nsec / 1000000);
+    }
+    fprintf(out, " }");
   }
   fprintf(out, " }");
 }
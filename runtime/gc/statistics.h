@@ -21,6 +21,20 @@ enum {
   SYNC_SAVE_WORLD,
 };
 
+/* Scheduler counters. The scheduler bumps these directly through the
+ * pointer returned by GC_getSchedCountersOfProc, so the order must match
+ * the indices in basis-library/schedulers/shh/Scheduler.sml and
+ * basis-library/mpl/sched.sml. */
+enum {
+  SCHED_STEALS = 0,
+  SCHED_FAILED_STEALS,
+  SCHED_TASKS_PUSHED,
+  SCHED_TASKS_POPPED,
+  SCHED_SEQUENTIAL_FORKS,
+  SCHED_STEAL_DISTANCE,
+  NUM_SCHED_COUNTERS,
+};
+
 struct GC_globalCumulativeStatistics {
   size_t maxHeapOccupancy;
 };
@@ -38,6 +52,11 @@ struct GC_cumulativeStatistics {
   uintmax_t bytesReclaimedByLocal;
   uintmax_t bytesReclaimedByRootCC;
   uintmax_t bytesReclaimedByInternalCC;
+  uintmax_t bytesUnreclaimedByRootCC; /* dead bytes in chunks kept by root CCs */
+  uintmax_t numSparseChunksByRootCC; /* kept chunks below CC_SPARSE_CHUNK_PERCENT live */
+  uintmax_t bytesRecoveredFromSparseChunks; /* dead bytes in sparse chunks freed by evacuating them */
+  uintmax_t bytesCoalesced; /* bytes of free chunks merged into a neighbor */
+  uintmax_t bytesDecommitted; /* bytes of free chunks returned to the OS */
 
   size_t maxBytesLive;
   size_t maxBytesLiveSinceReset;
@@ -60,11 +79,14 @@ struct GC_cumulativeStatistics {
   uintmax_t numGCs;
   uintmax_t numCopyingGCs;
   uintmax_t numHashConsGCs;
+  uintmax_t numDownPtrsRemembered;
   uintmax_t numMarkCompactGCs;
   uintmax_t numMinorGCs;
   uintmax_t numHHLocalGCs;
   uintmax_t numRootCCs;
   uintmax_t numInternalCCs;
+  uintmax_t numChunksCoalesced;
+  uintmax_t numAllocReserveRefills; /* batches of chunks set aside for allocation */
 
   struct timespec timeLocalGC;
   struct timespec timeLocalPromo;
@@ -72,6 +94,9 @@ struct GC_cumulativeStatistics {
   struct timespec timeRootCC;
   struct timespec timeInternalCC;
 
+  uint64_t schedCounters[NUM_SCHED_COUNTERS];
+  struct timespec timeJoin; /* in GC_HH_mergeThreads and GC_HH_promoteChunks */
+
   struct rusage ru_gc; /* total resource usage in gc. */
   struct rusage ru_gcCopying; /* resource usage in major copying gcs. */
   struct rusage ru_gcMarkCompact; /* resource usage in major mark-compact gcs. */
@@ -78,6 +78,9 @@ bool GC_TryToTerminate(GC_state s) {
     if (p != myself)
       s->procStates[p].limit = 0;
 
+  /* Parked workers are not running mutator code, so wake them explicitly. */
+  Parallel_wakeParked(s->numberOfProcs);
+
   Trace0(EVENT_HALT_WAIT);
 
   /* Wait for the other processors to terminate. */
@@ -47,6 +47,9 @@ void GC_HH_setMinLocalCollectionDepth(pointer threadp, Word32 depth) {
 
 void GC_HH_mergeThreads(pointer threadp, pointer childp) {
   GC_state s = pthread_getspecific(gcstate_key);
+  struct timespec startTime;
+  struct timespec stopTime;
+  timespec_now(&startTime);
 
   getStackCurrent(s)->used = sizeofGCStateCurrentStackUsed (s);
   getThreadCurrent(s)->exnStack = s->exnStack;
@@ -100,6 +103,11 @@ void GC_HH_mergeThreads(pointer threadp, pointer childp) {
   assert(getHierarchicalHeapCurrent(s) == thread->hierarchicalHeap);
 
   HM_HH_merge(s, thread, child);
+  saveSpareStack(s, child);
+
+  timespec_now(&stopTime);
+  timespec_sub(&stopTime, &startTime);
+  timespec_add(&(s->cumulativeStatistics->timeJoin), &stopTime);
 }
 
 #pragma message "TODO: do I need to do runtime enter/leave here? what about other primitives?"
@@ -107,9 +115,16 @@ void GC_HH_promoteChunks(pointer threadp) {
   GC_state s = pthread_getspecific(gcstate_key);
   GC_thread thread = threadObjptrToStruct(s, pointerToObjptr(threadp, NULL));
 
+  struct timespec startTime;
+  struct timespec stopTime;
+
   assert(thread != NULL);
   assert(thread->hierarchicalHeap != NULL);
+  timespec_now(&startTime);
   HM_HH_promoteChunks(s, thread);
+  timespec_now(&stopTime);
+  timespec_sub(&stopTime, &startTime);
+  timespec_add(&(s->cumulativeStatistics->timeJoin), &stopTime);
 }
 
 void GC_HH_moveNewThreadToDepth(pointer threadp, uint32_t depth) {
@@ -191,4 +206,51 @@ static inline GC_thread threadObjptrToStruct(GC_state s, objptr threadObjptr) {
   pointer threadPointer = objptrToPointer (threadObjptr, NULL);
   return ((GC_thread)(threadPointer + offsetofThread(s)));
 }
+
+void saveSpareStack(GC_state s, GC_thread thread) {
+  /* The worker that finished this thread releases it (currentProcNum = -1)
+   * only after its last write to the stack. The field is packed, so read it
+   * through a volatile access rather than taking its address, and fence
+   * before touching the stack. */
+  int32_t procNum = ((volatile struct GC_thread *)thread)->currentProcNum;
+  __sync_synchronize();
+  if (procNum >= 0 || BOGUS_OBJPTR == thread->stack)
+    return;
+
+  HM_chunk chunk = HM_getChunkOf(objptrToPointer(thread->stack, NULL));
+  if (chunk->mightContainMultipleObjects)
+    return;
+
+  HM_HierarchicalHeap hh = HM_getLevelHeadPathCompress(chunk);
+  HM_unlinkChunk(HM_HH_getChunkList(hh), chunk);
+  thread->stack = BOGUS_OBJPTR;
+
+  size_t numSpare = 0;
+  for (HM_chunk c = HM_getChunkListFirstChunk(getSpareStacks(s));
+       NULL != c;
+       c = c->nextChunk)
+  {
+    numSpare++;
+  }
+
+  if (numSpare < MAX_SPARE_STACKS)
+    HM_appendChunk(getSpareStacks(s), chunk);
+  else
+    HM_appendChunk(getFreeListSmall(s), chunk);
+}
+
+HM_chunk takeSpareStack(GC_state s, size_t reserved) {
+  HM_chunkList spares = getSpareStacks(s);
+  for (HM_chunk c = HM_getChunkListFirstChunk(spares);
+       NULL != c;
+       c = c->nextChunk)
+  {
+    GC_stack stack = (GC_stack)(HM_getChunkStart(c) + GC_STACK_METADATA_SIZE);
+    if (stack->reserved >= reserved) {
+      HM_unlinkChunk(spares, c);
+      return c;
+    }
+  }
+  return NULL;
+}
 #endif /* (defined (MLTON_GC_INTERNAL_FUNCS)) */
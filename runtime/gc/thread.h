@@ -113,6 +113,19 @@ static inline size_t offsetofThread (GC_state s);
  */
 static inline GC_thread threadObjptrToStruct(GC_state s, objptr threadObjptr);
 
+/* Each processor keeps up to MAX_SPARE_STACKS stack chunks of threads that
+ * have finished and been merged into their parent. newThreadWithHeap reuses
+ * them, so a steal does not have to allocate (and then regrow) a stack.
+ *
+ * saveSpareStack detaches the stack from the thread, leaving its stack
+ * field BOGUS_OBJPTR. It does nothing if the thread might still be running.
+ * takeSpareStack returns a detached chunk whose stack reserves at least
+ * `reserved` bytes, or NULL.
+ */
+#define MAX_SPARE_STACKS 8
+static void saveSpareStack(GC_state s, GC_thread thread);
+static HM_chunk takeSpareStack(GC_state s, size_t reserved);
+
 #endif /* (defined (MLTON_GC_INTERNAL_FUNCS)) */
 
 #endif /* THREAD_H_ */
@@ -36,6 +36,10 @@ void GC_memcpyToBuffer(pointer src, pointer buffer, size_t offset, size_t length
   GC_memcpy(src, buffer + offset, length);
 }
 
+void GC_memcpyFromBuffer(pointer buffer, size_t offset, pointer dst, size_t length) {
+  GC_memcpy(buffer + offset, dst, length);
+}
+
 static inline void GC_memmove (pointer src, pointer dst, size_t size) {
   if (DEBUG_DETAILED)
     fprintf (stderr, "GC_memmove ("FMTPTR", "FMTPTR", %"PRIuMAX")\n",
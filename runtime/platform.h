@@ -123,8 +123,11 @@ PRIVATE __attribute__ ((noreturn)) void MLton_heapCheckTooLarge (void);
 PRIVATE void GC_displayMem (void);
 
 PRIVATE void GC_memcpyToBuffer(pointer src, pointer buffer, size_t offset, size_t length);
+PRIVATE void GC_memcpyFromBuffer(pointer buffer, size_t offset, pointer dst, size_t length);
 
 PRIVATE void *GC_mmapFileReadable (int fd, size_t size);
+PRIVATE void *GC_mmapFileWritable (int fd, size_t size);
+PRIVATE void GC_adviseFileAccess (void *base, size_t length, int pattern);
 PRIVATE void *GC_mmapAnon (void *start, size_t length);
 PRIVATE void *GC_mmapAnonFlags (void *start, size_t length, int flags);
 PRIVATE void *GC_mmapAnon_safe (void *start, size_t length);
@@ -139,6 +142,9 @@ PRIVATE void *GC_mmapAnonFlags_safe_protect (void *start, size_t length,
                                              size_t dead_high);
 PRIVATE void *GC_mremap (void *start, size_t oldLength, size_t newLength);
 PRIVATE void GC_release (void *base, size_t length);
+/* Tell the OS that the pages in [base, base+length) are no longer needed.
+ * The range remains mapped, and reads as zeros when it is next touched. */
+PRIVATE void GC_decommit (void *base, size_t length);
 
 PRIVATE size_t GC_pageSize (void);
 PRIVATE uintmax_t GC_physMem (void);
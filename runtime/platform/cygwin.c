@@ -88,6 +88,11 @@ void GC_release (void *base, size_t length) {
                 Windows_release (base, length);
 }
 
+void GC_decommit (void *base, size_t length) {
+        if (MLton_Platform_CygwinUseMmap)
+                madvise_dontneed (base, length);
+}
+
 void* GC_extendHead (void *base, size_t length) {
         if (MLton_Platform_CygwinUseMmap)
                 return mmapAnon (base, length);
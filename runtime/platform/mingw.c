@@ -17,6 +17,11 @@ void GC_release (void *base, size_t length) {
         Windows_release (base, length);
 }
 
+void GC_decommit (__attribute__ ((unused)) void *base,
+                  __attribute__ ((unused)) size_t length) {
+        /* not supported; the memory stays committed until released */
+}
+
 void *GC_extendHead (void *base, size_t length) {
         return Windows_mmapAnon (base, length);
 }
@@ -2,6 +2,10 @@ static inline void *mmapFileReadable (int fd, size_t size) {
   return mmap (0, size, PROT_READ, MAP_PRIVATE, fd, 0);
 }
 
+static inline void *mmapFileWritable (int fd, size_t size) {
+  return mmap (0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+}
+
 static inline void *mmapAnonFlags (void *start, size_t length, int flags) {
         return mmap (start, length, PROT_READ | PROT_WRITE,
                         MAP_PRIVATE | MAP_ANON | flags, -1, 0);
@@ -11,6 +15,14 @@ static inline void *mmapAnon (void *start, size_t length) {
         return mmapAnonFlags (start, length, 0);
 }
 
+static void madvise_dontneed (void *base, size_t length) {
+        assert (base != NULL);
+        if (0 == length)
+                return;
+        if (0 != madvise (base, length, MADV_DONTNEED))
+                diee ("madvise failed");
+}
+
 static void munmap_safe (void *base, size_t length) {
         assert (base != NULL);
         if (0 == length)
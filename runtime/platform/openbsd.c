@@ -11,6 +11,10 @@ void GC_release (void *base, size_t length) {
         munmap_safe (base, length);
 }
 
+void GC_decommit (void *base, size_t length) {
+        madvise_dontneed (base, length);
+}
+
 void *GC_mmapAnon (void *start, size_t length) {
         return mmapAnonFlags (start, length, MAP_STACK);
 }
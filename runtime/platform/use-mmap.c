@@ -4,10 +4,33 @@ void GC_release (void *base, size_t length) {
         munmap_safe (base, length);
 }
 
+void GC_decommit (void *base, size_t length) {
+        madvise_dontneed (base, length);
+}
+
 void *GC_mmapFileReadable (int fd, size_t size) {
   return mmapFileReadable(fd, size);
 }
 
+void *GC_mmapFileWritable (int fd, size_t size) {
+  return mmapFileWritable(fd, size);
+}
+
+/* Access pattern hint for part of a file mapping: 0 normal, 1 sequential,
+ * 2 random, 3 will need soon. The range is widened to whole pages. This
+ * is only a hint, so failure is ignored. */
+void GC_adviseFileAccess (void *base, size_t length, int pattern) {
+  static const int advice[] =
+    { MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED };
+  size_t pageSize = GC_pageSize ();
+  uintptr_t start = alignDown ((uintptr_t)base, pageSize);
+  uintptr_t end = (uintptr_t)base + length;
+
+  if (0 == length || pattern < 0 || pattern > 3)
+    return;
+  madvise ((void *)start, end - start, advice[pattern]);
+}
+
 void *GC_mmapAnon (void *start, size_t length) {
         return mmapAnon (start, length);
 }
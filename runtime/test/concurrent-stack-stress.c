@@ -0,0 +1,119 @@
+/* Stress test for CC_stack: write barriers on several threads push while the
+ * owner repeatedly clears the stack for a new collection. After each round
+ * the pushers are stopped and the stack is checked:
+ *   - every slot up to the stack size holds a datum (no holes for the
+ *     collector to spin on),
+ *   - no datum appears twice,
+ *   - every push that began after the last clear returned is present.
+ * Run with `make check`.
+ */
+
+#include "gc.c"
+
+C_Pthread_Key_t gcstate_key;
+GC_state MLton_gcState(void) { return NULL; }
+
+#define NUM_PUSHERS 4
+#define NUM_ROUNDS 200
+#define CLEARS_PER_ROUND 50
+
+static CC_stack stack;
+static volatile size_t clears;
+static volatile bool stop;
+
+struct pusher {
+    pthread_t thread;
+    size_t id;
+    size_t next;         // sequence number of the next push
+    size_t sinceClear;   // first push that began after the latest clear
+    volatile size_t seen; // number of clears this pusher has noticed
+};
+
+static struct pusher pushers[NUM_PUSHERS];
+
+static void* encode(size_t id, size_t seq) {
+    return (void*)(((seq + 1) << 8) | (id << 3));
+}
+
+static void* pushLoop(void* arg) {
+    struct pusher* p = arg;
+    p->sinceClear = p->next;
+    while (!stop) {
+        size_t c = clears;
+        if (c != p->seen) {
+            p->seen = c;
+            p->sinceClear = p->next;
+        }
+        CC_stack_push(&stack, encode(p->id, p->next));
+        p->next++;
+    }
+    return NULL;
+}
+
+static void fail(const char* what, size_t round) {
+    fprintf(stderr, "concurrent-stack-stress: %s in round %zu\n", what, round);
+    exit(1);
+}
+
+static void check(size_t round) {
+    bool* present[NUM_PUSHERS];
+    for (size_t i = 0; i < NUM_PUSHERS; i++)
+        present[i] = calloc(pushers[i].next + 1, sizeof(bool));
+
+    size_t count = 0;
+    for (CC_stackSegment* seg = stack.top; seg != NULL; seg = seg->next) {
+        for (size_t i = 0; i < segmentSize(seg); i++) {
+            uintptr_t d = (uintptr_t)seg->storage[i];
+            if (d == 0)
+                fail("hole below the stack size", round);
+            size_t id = (d >> 3) & 0x1F;
+            size_t seq = (d >> 8) - 1;
+            if (id >= NUM_PUSHERS || seq >= pushers[id].next)
+                fail("datum that was never pushed", round);
+            if (present[id][seq])
+                fail("datum pushed once but stored twice", round);
+            present[id][seq] = TRUE;
+            count++;
+        }
+    }
+    if (count != CC_stack_size(&stack))
+        fail("stack size disagrees with its contents", round);
+
+    for (size_t i = 0; i < NUM_PUSHERS; i++) {
+        for (size_t seq = pushers[i].sinceClear; seq < pushers[i].next; seq++)
+            if (!present[i][seq])
+                fail("push after the last clear was lost", round);
+        free(present[i]);
+    }
+}
+
+int main(void) {
+    for (size_t round = 0; round < NUM_ROUNDS; round++) {
+        // start small so that rounds also exercise growing and merging
+        CC_stack_init(&stack, 2);
+        stop = FALSE;
+        for (size_t i = 0; i < NUM_PUSHERS; i++) {
+            pushers[i].id = i;
+            pushers[i].next = 0;
+            pushers[i].seen = clears;
+            pthread_create(&(pushers[i].thread), NULL, pushLoop, &pushers[i]);
+        }
+
+        for (size_t i = 0; i < CLEARS_PER_ROUND; i++) {
+            for (volatile size_t spin = 0; spin < 10000; spin++) {}
+            CC_stack_clear(&stack);
+            __sync_fetch_and_add(&clears, 1);
+        }
+
+        // let every pusher notice the last clear, so the check covers it
+        for (size_t i = 0; i < NUM_PUSHERS; i++)
+            while (pushers[i].seen != clears) {}
+        stop = TRUE;
+        for (size_t i = 0; i < NUM_PUSHERS; i++)
+            pthread_join(pushers[i].thread, NULL);
+        check(round);
+        CC_stack_free(&stack);
+    }
+    printf("concurrent-stack-stress: ok\n");
+    return 0;
+}